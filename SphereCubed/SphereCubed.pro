@@ -1,50 +1,101 @@
-QT += core gui opengl
+QT += core gui opengl concurrent
 
 TARGET = SphereCubed
 
 TEMPLATE = app
 
 SOURCES += \
+    analyzer.cpp \
+    arena.cpp \
+    benchmark.cpp \
     box.cpp \
+    bus.cpp \
     camera.cpp \
+    chunkbenchmark.cpp \
+    chunkstore.cpp \
     cube.cpp \
+    cyclebenchmark.cpp \
+    dispatchbenchmark.cpp \
     engine.cpp \
     frustum.cpp \
     game.cpp \
+    generator.cpp \
+    input.cpp \
+    jobs.cpp \
+    latency.cpp \
     level.cpp \
+    levelpack.cpp \
+    levelparser.cpp \
     light.cpp \
     machine.cpp \
     main.cpp \
+    memory.cpp \
     menu.cpp \
+    pacer.cpp \
     physics.cpp \
     plane.cpp \
     player.cpp \
+    regression.cpp \
+    simulation.cpp \
     sphere.cpp \
+    supportcheck.cpp \
     window.cpp \
     world.cpp
 
 HEADERS += \
+    analyzer.h \
+    arena.h \
+    benchmark.h \
     box.h \
+    bus.h \
     camera.h \
+    chunkbenchmark.h \
+    chunkstore.h \
     cube.h \
+    cyclebenchmark.h \
+    dispatchbenchmark.h \
     engine.h \
     frustum.h \
     game.h \
+    generator.h \
+    input.h \
+    jobs.h \
+    latency.h \
     level.h \
+    levelpack.h \
+    levelparser.h \
     light.h \
     machine.h \
+    memory.h \
     menu.h \
+    options.h \
+    pacer.h \
     physics.h \
     plane.h \
     player.h \
+    regression.h \
     settings.h \
+    simulation.h \
     sphere.h \
+    spscqueue.h \
+    staticmachine.h \
+    supportcheck.h \
     trace.h \
+    triplebuffer.h \
     window.h \
+    workdeque.h \
     world.h
 
 DISTFILES += \
     SphereCubed.png \
+    Golden/Level1.golden \
+    Golden/Level2.golden \
+    Golden/Level3.golden \
+    Golden/Level4.golden \
+    Golden/Level5.golden \
+    Golden/Level6.golden \
+    Golden/Level7.golden \
+    Golden/Level8.golden \
     Images/Concrete.png \
     Images/Died.png \
     Images/Finish.png \
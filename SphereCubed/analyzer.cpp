@@ -0,0 +1,382 @@
+/*! \file analyzer.cpp
+\brief Analyzer class implementation file.
+This file contains the Analyzer class implementation for the application.
+*/
+
+// analyzer.h header file required for Analyzer class definition.
+#include "analyzer.h"
+
+// QElapsedTimer header file required for timing the analysis.
+#include <QElapsedTimer>
+
+// settings.h header file required for application settings.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Number of directions the Player can roll in.
+#define ANALYZER_DIRECTION_COUNT 4
+
+//! Column step of each direction.
+static const int DIRECTION_X[ ANALYZER_DIRECTION_COUNT ] = { 1, -1, 0,  0 };
+
+//! Row step of each direction.
+static const int DIRECTION_Z[ ANALYZER_DIRECTION_COUNT ] = { 0,  0, 1, -1 };
+
+//! The Analyzer execution begins here.
+//! Create an Analyzer with its own World.
+Analyzer::Analyzer() :
+    mWorld( ENGINE_TICK_INTERVAL ),
+    mOut( stdout )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Analyzer::Analyzer()...";
+} // Analyzer::Analyzer()
+
+//! The Analyzer execution ends here.
+//! Destroy the Analyzer.
+Analyzer::~Analyzer()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Analyzer::~Analyzer()...";
+} // Analyzer::~Analyzer()
+
+//! Analyze a Level.
+//! Reports unreachable finishes, dead end regions and the shortest path length.
+//! \param level is a Level index or a Level file name.
+//! \return int is the process exit status, zero when a finish is reachable.
+int Analyzer::analyze( const QString & level )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Analyzer::analyze()...";
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QVector<int> finishes;
+    int start;
+
+    if( loadGraph( level, finishes, start ) == false )
+    {
+        return 1;
+    }
+
+    qint64 loadTime = timer.restart();
+
+    int count = mColumns * mRows;
+
+    //! Queue shared by the searches, every cell is queued at most once per search.
+    QVector<int> queue( count );
+
+    //! Breadth first search from the start, distance is -1 until reached.
+    QVector<int> distance;
+    int reachableCount = searchFromStart( start, distance, queue );
+
+    //! Reverse breadth first search from every finish finds the cells that can still finish.
+    QVector<bool> canFinish( count, false );
+    int head = 0;
+    int tail = 0;
+
+    foreach( int finish, finishes )
+    {
+        canFinish[finish] = true;
+        queue[tail++] = finish;
+    }
+
+    while( head < tail )
+    {
+        int to = queue[head++];
+
+        for( int d = 0; d < ANALYZER_DIRECTION_COUNT; d++ )
+        {
+            int from;
+
+            if( canArrive( to, DIRECTION_X[d], DIRECTION_Z[d], from ) && canFinish[from] == false )
+            {
+                canFinish[from] = true;
+                queue[tail++] = from;
+            }
+        } // for( int d = 0; d < ANALYZER_DIRECTION_COUNT; d++ )
+    } // while( head < tail )
+
+    //! Dead end cells are reachable but can no longer finish, group them into regions.
+    int deadEndCells   = 0;
+    int deadEndRegions = 0;
+    QVector<bool> grouped( count, false );
+
+    for( int cell = 0; cell < count; cell++ )
+    {
+        if( distance[cell] < 0 || canFinish[cell] || grouped[cell] )
+        {
+            continue;
+        }
+
+        //! Flood fill the region of neighbouring dead end cells.
+        deadEndRegions++;
+        head = 0;
+        tail = 0;
+        grouped[cell] = true;
+        queue[tail++] = cell;
+
+        while( head < tail )
+        {
+            int current = queue[head++];
+            int x = current % mColumns;
+            int z = current / mColumns;
+            deadEndCells++;
+
+            for( int d = 0; d < ANALYZER_DIRECTION_COUNT; d++ )
+            {
+                int nx = x + DIRECTION_X[d];
+                int nz = z + DIRECTION_Z[d];
+
+                if( nx < 0 || nz < 0 || nx >= mColumns || nz >= mRows )
+                {
+                    continue;
+                }
+
+                int next = nz * mColumns + nx;
+
+                if( distance[next] >= 0 && canFinish[next] == false && grouped[next] == false )
+                {
+                    grouped[next] = true;
+                    queue[tail++] = next;
+                }
+            } // for( int d = 0; d < ANALYZER_DIRECTION_COUNT; d++ )
+        } // while( head < tail )
+    } // for( int cell = 0; cell < count; cell++ )
+
+    qint64 analyzeTime = timer.elapsed();
+
+    //! Report the results.
+    mOut << "Level " << level << ": " << mColumns << "x" << mRows << ", "
+         << reachableCount << " reachable cells" << endl;
+
+    int shortest = -1;
+
+    foreach( int finish, finishes )
+    {
+        if( distance[finish] < 0 )
+        {
+            mOut << "  unreachable finish at " << finish % mColumns << "," << finish / mColumns << endl;
+        }
+        else if( shortest < 0 || distance[finish] < shortest )
+        {
+            shortest = distance[finish];
+        }
+    } // foreach( int finish, finishes )
+
+    if( shortest >= 0 )
+    {
+        mOut << "  shortest path " << shortest << " moves" << endl;
+    }
+    else
+    {
+        mOut << "  no finish is reachable" << endl;
+    }
+
+    mOut << "  " << deadEndRegions << " dead end regions, " << deadEndCells << " cells" << endl;
+    mOut << "  load " << loadTime << " mS, analysis " << analyzeTime << " mS" << endl;
+
+    return ( shortest >= 0 ) ? 0 : 1;
+} // Analyzer::analyze( const QString & level )
+
+//! Test if the Player can roll to a cell from one or two cells over in a direction.
+//! This is the reverse of canMove, used to search back from the finish.
+//! \param to is the cell arrived at.
+//! \param dx is the column step of the direction the Player rolls in.
+//! \param dz is the row step of the direction the Player rolls in.
+//! \param from is set to the cell the Player rolls from.
+//! \return bool is true if there is such a cell.
+bool Analyzer::canArrive( int to, int dx, int dz, int & from ) const
+{
+    int x = to % mColumns - dx;
+    int z = to / mColumns - dz;
+
+    if( mHeight[to] == HOLE_HEIGHT || x < 0 || z < 0 || x >= mColumns || z >= mRows )
+    {
+        return false;
+    }
+
+    //! Rolled from the neighbour, which must not be lower.
+    from = z * mColumns + x;
+
+    if( mHeight[from] != HOLE_HEIGHT )
+    {
+        return mHeight[to] <= mHeight[from];
+    }
+
+    //! Rolled over a hole from the cell beyond it, which must be higher.
+    x -= dx;
+    z -= dz;
+
+    if( x < 0 || z < 0 || x >= mColumns || z >= mRows )
+    {
+        return false;
+    }
+
+    from = z * mColumns + x;
+
+    return mHeight[from] != HOLE_HEIGHT && mHeight[to] < mHeight[from];
+} // Analyzer::canArrive( int to, int dx, int dz, int & from ) const
+
+//! Test if the Player can roll from a cell one or two cells over in a direction.
+//! A neighbouring Cube can be rolled onto if it is not higher, the Player cannot climb.
+//! A single hole can be rolled over onto a lower Cube, the drop carries the Player across.
+//! \param from is the cell rolled from.
+//! \param dx is the column step of the direction.
+//! \param dz is the row step of the direction.
+//! \param to is set to the cell rolled to.
+//! \return bool is true if the Player can roll in the direction.
+bool Analyzer::canMove( int from, int dx, int dz, int & to ) const
+{
+    int x = from % mColumns + dx;
+    int z = from / mColumns + dz;
+
+    if( x < 0 || z < 0 || x >= mColumns || z >= mRows )
+    {
+        return false;
+    }
+
+    //! Roll onto the neighbour if it is not higher.
+    to = z * mColumns + x;
+
+    if( mHeight[to] != HOLE_HEIGHT )
+    {
+        return mHeight[to] <= mHeight[from];
+    }
+
+    //! Roll over the hole onto a lower Cube beyond it.
+    x += dx;
+    z += dz;
+
+    if( x < 0 || z < 0 || x >= mColumns || z >= mRows )
+    {
+        return false;
+    }
+
+    to = z * mColumns + x;
+
+    return mHeight[to] != HOLE_HEIGHT && mHeight[to] < mHeight[from];
+} // Analyzer::canMove( int from, int dx, int dz, int & to ) const
+
+//! Load a Level and copy its cells into the flat graph arrays.
+//! \param level is a Level index or a Level file name.
+//! \param finishes is set to the finish cells.
+//! \param start is set to the start cell.
+//! \return bool is true when the Level loaded with a start and a finish, else the reason is reported.
+bool Analyzer::loadGraph( const QString & level, QVector<int> & finishes, int & start )
+{
+    Level & data = mWorld.level();
+
+    //! A number selects a shipped Level, anything else is a Level file.
+    bool isIndex = false;
+    uint index = level.toUInt( &isIndex );
+
+    data.levelIndex() = isIndex ? index : 0;
+    data.levelFile()  = isIndex ? QString() : level;
+
+    if( data.loadData() == false )
+    {
+        mOut << "Unable to load level " << level << ", " << data.loadError() << endl;
+        return false;
+    }
+
+    //! Copy the cells into the flat graph arrays.
+    mColumns = data.cubeColumns();
+    mRows    = data.cubeRows();
+    int count = mColumns * mRows;
+
+    mHeight.resize( count );
+    finishes.clear();
+
+    for( int z = 0; z < mRows; z++ )
+    {
+        for( int x = 0; x < mColumns; x++ )
+        {
+            Cube::CubeType type = data.cubeType( x, z );
+            mHeight[ z * mColumns + x ] = ( type == Cube::HOLE ) ? HOLE_HEIGHT : (qint16)data.cubeHeight( x, z );
+
+            if( type == Cube::FINISH )
+            {
+                finishes.append( z * mColumns + x );
+            }
+        } // for( int x = 0; x < mColumns; x++ )
+    } // for( int z = 0; z < mRows; z++ )
+
+    start = qRound( data.startPosition().z() ) * mColumns + qRound( data.startPosition().x() );
+
+    if( start < 0 || start >= count || finishes.isEmpty() )
+    {
+        mOut << "Level " << level << " has no start or no finish" << endl;
+        return false;
+    }
+
+    return true;
+} // Analyzer::loadGraph( const QString & level, QVector<int> & finishes, int & start )
+
+//! Breadth first search from the start over the flat graph arrays.
+//! \param start is the start cell.
+//! \param distance is set to the moves from the start to every cell, -1 when it cannot be reached.
+//! \param queue is the search queue, one entry per cell.
+//! \return int is the number of reachable cells.
+int Analyzer::searchFromStart( int start, QVector<int> & distance, QVector<int> & queue ) const
+{
+    distance.fill( -1, mColumns * mRows );
+
+    int head = 0;
+    int tail = 0;
+
+    distance[start] = 0;
+    queue[tail++] = start;
+
+    while( head < tail )
+    {
+        int from = queue[head++];
+
+        for( int d = 0; d < ANALYZER_DIRECTION_COUNT; d++ )
+        {
+            int to;
+
+            if( canMove( from, DIRECTION_X[d], DIRECTION_Z[d], to ) && distance[to] < 0 )
+            {
+                distance[to] = distance[from] + 1;
+                queue[tail++] = to;
+            }
+        } // for( int d = 0; d < ANALYZER_DIRECTION_COUNT; d++ )
+    } // while( head < tail )
+
+    return tail;
+} // Analyzer::searchFromStart( int start, QVector<int> & distance, QVector<int> & queue ) const
+
+//! Find the shortest path of a Level, the par of the Level packs.
+//! \param level is a Level index or a Level file name.
+//! \return int is the moves from the start to the nearest finish, -1 when none is reachable.
+int Analyzer::shortestPath( const QString & level )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Analyzer::shortestPath()...";
+
+    QVector<int> finishes;
+    int start;
+
+    if( loadGraph( level, finishes, start ) == false )
+    {
+        return -1;
+    }
+
+    QVector<int> distance;
+    QVector<int> queue( mColumns * mRows );
+    searchFromStart( start, distance, queue );
+
+    int shortest = -1;
+
+    foreach( int finish, finishes )
+    {
+        if( distance[finish] >= 0 && ( shortest < 0 || distance[finish] < shortest ) )
+        {
+            shortest = distance[finish];
+        }
+    } // foreach( int finish, finishes )
+
+    return shortest;
+} // Analyzer::shortestPath( const QString & level )
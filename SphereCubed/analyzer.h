@@ -0,0 +1,78 @@
+/*! \file analyzer.h
+\brief Analyzer class declaration file.
+This file contains the Analyzer class declaration for the application.
+*/
+
+#ifndef ANALYZER_H
+#define ANALYZER_H
+
+// QString header file required for the Level name.
+#include <QString>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for the flat graph arrays.
+#include <QVector>
+
+// world.h header file required for World access.
+#include "world.h"
+
+//! Analyzer class.
+/*!
+This class declaration encapsulates the Level reachability Analyzer functionality.
+The Level is loaded through Level and its cells are copied into flat arrays. The
+walkable graph is implicit in those arrays: a Player can roll to a neighbouring Cube
+that is not higher, and can cross a single hole onto a Cube that is lower. A breadth
+first search from the start finds the shortest path to the finish, and a reverse
+search from the finish finds the dead end regions.
+*/
+class Analyzer
+{
+public: // Constructors / Destructors
+    //! Analyzer class constructor.
+    Analyzer();
+
+    //! Analyzer class destructor.
+    ~Analyzer();
+
+public: // Member Functions
+    //! Called to analyze a Level given by index or file name.
+    int analyze( const QString & level );
+
+    //! Called to find the moves of the shortest path from the start to a finish of a Level.
+    int shortestPath( const QString & level );
+
+private: // Member Variables
+    //! Used to store the World the Level is loaded into.
+    World mWorld;
+
+    //! Used to store the number of columns in the graph.
+    int mColumns = 0;
+
+    //! Used to store the number of rows in the graph.
+    int mRows = 0;
+
+    //! Used to store the height of each cell, holes are negative.
+    QVector<qint16> mHeight;
+
+    //! Used to write the report.
+    QTextStream mOut;
+
+private: // Data Constants
+    //! Height stored for a hole cell.
+    const qint16 HOLE_HEIGHT = -1;
+
+private: // Helper Functions
+    //! Called to test if the Player can roll from a cell one or two cells over in a direction.
+    bool canMove( int from, int dx, int dz, int & to ) const;
+
+    //! Called to test if the Player can roll to a cell from one or two cells over in a direction.
+    bool canArrive( int to, int dx, int dz, int & from ) const;
+
+    //! Called to load a Level into the flat graph arrays.
+    bool loadGraph( const QString & level, QVector<int> & finishes, int & start );
+
+    //! Called to search the flat graph arrays breadth first from the start.
+    int searchFromStart( int start, QVector<int> & distance, QVector<int> & queue ) const;
+}; // class Analyzer
+
+#endif // ANALYZER_H
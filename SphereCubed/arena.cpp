@@ -0,0 +1,214 @@
+/*! \file arena.cpp
+\brief Arena class implementation file.
+This file contains the Level memory Arena class implementation for the application.
+*/
+
+// arena.h header file required for Arena class definition.
+#include "arena.h"
+
+// QMutexLocker header file required for guarding the pool.
+#include <QMutexLocker>
+// QtGlobal header file required for the aligned heap blocks.
+#include <QtGlobal>
+
+// memory.h header file required for counting the pooled Arenas.
+#include "memory.h"
+// settings.h header file required for the block size and the pool limits.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The Arena execution begins here.
+//! Arenas are created by acquire() when the pool is empty.
+Arena::Arena()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Arena::Arena()...";
+} // Arena::Arena()
+
+//! The Arena execution ends here.
+//! Frees the blocks of the Arena.
+Arena::~Arena()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Arena::~Arena()...";
+
+    foreach( const Block & block, mBlocks )
+    {
+        pool().bytes -= block.size;
+        qFreeAligned( block.pData );
+    } // foreach( const Block & block, mBlocks )
+} // Arena::~Arena()
+
+//! The Pool execution ends when the process exits.
+//! Frees the pooled Arenas.
+Arena::Pool::~Pool()
+{
+    foreach( Arena * pArena, arenas )
+    {
+        delete pArena;
+    } // foreach( Arena * pArena, arenas )
+} // Arena::Pool::~Pool()
+
+//! Take a reset Arena from the pool, or create one when the pool is empty.
+//! \return Arena * is the Arena, owned by the caller until it is recycled.
+Arena * Arena::acquire()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Arena::acquire()...";
+
+    Pool & shared = pool();
+    shared.acquired++;
+
+    {
+        QMutexLocker locker( &shared.mutex );
+
+        if( shared.arenas.isEmpty() == false )
+        {
+            shared.reused++;
+            Arena * pArena = shared.arenas.last();
+            shared.arenas.removeLast();
+            Memory::freed( Memory::ARENA_POOL, pArena->mReserved );
+            return pArena;
+        } // if( shared.arenas.isEmpty() == false )
+    }
+
+    return new Arena();
+} // Arena::acquire()
+
+//! Allocate a number of bytes out of the last block, taking a new block when they do not fit.
+//! \param bytes is the number of bytes, rounded up to keep the next allocation aligned.
+//! \return void * is the allocation, aligned to a cache line.
+void * Arena::allocateBytes( qint64 bytes )
+{
+    bytes = ( bytes + ARENA_ALIGNMENT - 1 ) & ~(qint64)( ARENA_ALIGNMENT - 1 );
+
+    if( mBlocks.isEmpty() == true || mOffset + bytes > mBlocks.last().size )
+    {
+        grow( bytes );
+    } // if( mBlocks.isEmpty() == true || ... )
+
+    void * pAllocation = mBlocks.last().pData + mOffset;
+    mOffset += bytes;
+    mUsed   += bytes;
+
+    return pAllocation;
+} // Arena::allocateBytes( qint64 bytes )
+
+//! Take a block of at least a number of bytes from the heap, the next allocations are cut out of it.
+//! \param bytes is the least number of bytes of the block.
+//! \return void
+void Arena::grow( qint64 bytes )
+{
+    Block block;
+    block.size  = qMax( bytes, (qint64)LEVEL_ARENA_BLOCK );
+    block.pData = static_cast< char * >( qMallocAligned( block.size, ARENA_ALIGNMENT ) );
+    Q_CHECK_PTR( block.pData );
+
+    mBlocks.append( block );
+    mOffset    = 0;
+    mReserved += block.size;
+
+    //! Count the heap block and the most bytes held at once.
+    Pool & shared = pool();
+    shared.blocks++;
+    qint64 held = ( shared.bytes += block.size );
+    qint64 peak = shared.peak.load();
+    while( held > peak && shared.peak.compare_exchange_weak( peak, held ) == false ) {}
+} // Arena::grow( qint64 bytes )
+
+//! Get the pool shared by the process, created on first use.
+//! \return Pool & is the pool.
+Arena::Pool & Arena::pool()
+{
+    static Pool shared;
+    return shared;
+} // Arena::pool()
+
+//! Reset an Arena and return it to the pool, every allocation out of it is released at once.
+//! An Arena too large to keep, or one more than the pool holds, is freed instead.
+//! \param pArena is the Arena to recycle, nothing is done when NULL.
+//! \return void
+void Arena::recycle( Arena * pArena )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Arena::recycle( Arena * pArena )...";
+
+    if( pArena == NULL )
+    {
+        return;
+    } // if( pArena == NULL )
+
+    pArena->reset();
+
+    if( pArena->mReserved <= LEVEL_ARENA_RETAIN )
+    {
+        Pool & shared = pool();
+        QMutexLocker locker( &shared.mutex );
+
+        if( shared.arenas.size() < LEVEL_ARENA_POOL )
+        {
+            shared.arenas.append( pArena );
+            Memory::allocated( Memory::ARENA_POOL, pArena->mReserved );
+            return;
+        } // if( shared.arenas.size() < LEVEL_ARENA_POOL )
+    } // if( pArena->mReserved <= LEVEL_ARENA_RETAIN )
+
+    delete pArena;
+} // Arena::recycle( Arena * pArena )
+
+//! Report the Arena pool and heap counters.
+//! \param out is the stream to report to.
+//! \return void
+void Arena::report( QTextStream & out )
+{
+    Pool & shared = pool();
+    int pooled = 0;
+
+    {
+        QMutexLocker locker( &shared.mutex );
+        pooled = shared.arenas.size();
+    }
+
+    out << "arena: " << shared.acquired.load() << " acquired, " << shared.reused.load() << " from the pool, "
+        << shared.blocks.load() << " heap blocks, " << pooled << " pooled, "
+        << shared.bytes.load() << " bytes held, peak " << shared.peak.load() << " bytes" << endl;
+} // Arena::report( QTextStream & out )
+
+//! Make sure a number of bytes can be allocated without taking another block,
+//! so the allocations of a Level known up front share a single block.
+//! \param bytes is the number of bytes about to be allocated.
+//! \return void
+void Arena::reserve( qint64 bytes )
+{
+    if( mBlocks.isEmpty() == true || mOffset + bytes > mBlocks.last().size )
+    {
+        grow( bytes );
+    } // if( mBlocks.isEmpty() == true || ... )
+} // Arena::reserve( qint64 bytes )
+
+//! Reset the Arena, releasing every allocation at once.
+//! An Arena that grew more than one block has them coalesced in a single block of their
+//! total size, so the next Level of a similar size fits in it.
+//! \return void
+void Arena::reset()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Arena::reset()...";
+
+    if( mBlocks.size() > 1 )
+    {
+        qint64 total = mReserved;
+
+        foreach( const Block & block, mBlocks )
+        {
+            pool().bytes -= block.size;
+            qFreeAligned( block.pData );
+        } // foreach( const Block & block, mBlocks )
+
+        mBlocks.clear();
+        mReserved = 0;
+        grow( total );
+    } // if( mBlocks.size() > 1 )
+
+    mOffset = 0;
+    mUsed   = 0;
+} // Arena::reset()
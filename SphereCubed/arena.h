@@ -0,0 +1,152 @@
+/*! \file arena.h
+\brief Arena class declaration file.
+This file contains the Level memory Arena class declaration for the application.
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+// QMutex header file required for guarding the pool.
+#include <QMutex>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for the blocks and the pool.
+#include <QVector>
+
+// atomic header file required for the heap counters.
+#include <atomic>
+// type_traits header file required for checking the allocated types need no destructor.
+#include <type_traits>
+
+//! Alignment of the blocks and the allocations, a cache line so the Jobs workers filling
+//! neighbouring arrays do not share one.
+#define ARENA_ALIGNMENT 64
+
+//! Arena class.
+/*!
+This class declaration encapsulates the Level memory Arena functionality.
+Every allocation that lives as long as a Level, the packed cell arrays, the culling
+results and the render window of a chunked Level, is cut out of the blocks of one Arena
+by moving an offset, and the whole Level is released at once by resetting the Arena, no
+element is destroyed and no allocation is freed one at a time. Only types without a
+destructor can be allocated.
+A reset Arena keeps its memory, coalesced in a single block, and returns to a small pool
+shared by the process, so the next Level of a similar size is prepared without touching
+the heap and loading Levels over and over does not fragment it.
+An Arena is used by one thread at a time, the pool can be used from any thread.
+*/
+class Arena
+{
+public: // Static Functions
+    //! Called on any thread to take a reset Arena from the pool, or a new one.
+    static Arena * acquire();
+
+    //! Called to get the number of bytes an array takes out of an Arena, with its alignment.
+    template< typename T >
+    static qint64 footprint( uint count ) { return ( (qint64)count * sizeof( T ) + ARENA_ALIGNMENT - 1 ) & ~(qint64)( ARENA_ALIGNMENT - 1 ); }
+
+    //! Called to get the number of blocks the Arenas took from the heap so far.
+    static qint64 heapBlocks() { return pool().blocks.load(); }
+
+    //! Called on any thread to reset an Arena in a single step and return it to the pool.
+    static void recycle( Arena * pArena );
+
+    //! Called to report the Arena pool and heap counters.
+    static void report( QTextStream & out );
+
+public: // Access Functions
+    //! Called to get the number of bytes of the blocks.
+    qint64 reserved() const { return mReserved; }
+
+    //! Called to get the number of bytes allocated since the last reset.
+    qint64 used() const { return mUsed; }
+
+public: // Member Functions
+    //! Called to allocate an uninitialised array out of the Arena.
+    template< typename T >
+    T * allocate( uint count );
+
+    //! Called to make sure a number of bytes can be allocated without another block.
+    void reserve( qint64 bytes );
+
+private: // Constructors / Destructors
+    //! Arena class constructor.
+    Arena();
+
+    //! Arena class destructor.
+    ~Arena();
+
+private: // Data Types
+    //! Internal block of memory taken from the heap.
+    struct Block
+    {
+        //! - Start of the block, aligned.
+        char * pData;
+        //! - Number of bytes of the block.
+        qint64 size;
+    }; // struct Block
+
+    //! Internal pool of reset Arenas and heap counters shared by the process.
+    struct Pool
+    {
+        //! - Used to guard the reset Arenas.
+        QMutex mutex;
+        //! - The reset Arenas ready to be acquired.
+        QVector< Arena * > arenas;
+        //! - Number of Arenas acquired.
+        std::atomic< qint64 > acquired;
+        //! - Number of Arenas acquired from the pool instead of created.
+        std::atomic< qint64 > reused;
+        //! - Number of blocks taken from the heap.
+        std::atomic< qint64 > blocks;
+        //! - Number of bytes of the blocks held now.
+        std::atomic< qint64 > bytes;
+        //! - Most bytes of the blocks held at once.
+        std::atomic< qint64 > peak;
+
+        //! Pool constructor.
+        Pool() : acquired( 0 ), reused( 0 ), blocks( 0 ), bytes( 0 ), peak( 0 ) {}
+
+        //! Pool destructor, frees the pooled Arenas when the process exits.
+        ~Pool();
+    }; // struct Pool
+
+private: // Helper Functions
+    //! Called to allocate a number of bytes out of the Arena.
+    void * allocateBytes( qint64 bytes );
+
+    //! Called to take a block of at least a number of bytes from the heap.
+    void grow( qint64 bytes );
+
+    //! Called to get the pool shared by the process.
+    static Pool & pool();
+
+    //! Called to reset the Arena, keeping its memory in a single block.
+    void reset();
+
+private: // Member Variables
+    //! Used to store the blocks, the last one is being allocated from.
+    QVector< Block > mBlocks;
+
+    //! Used to store the offset of the next allocation in the last block.
+    qint64 mOffset = 0;
+
+    //! Used to store the number of bytes allocated since the last reset.
+    qint64 mUsed = 0;
+
+    //! Used to store the number of bytes of the blocks.
+    qint64 mReserved = 0;
+}; // class Arena
+
+//! Allocate an uninitialised array out of the Arena, released when the Arena is reset.
+//! \param count is the number of elements.
+//! \return T * is the array, aligned to a cache line.
+template< typename T >
+T * Arena::allocate( uint count )
+{
+    static_assert( std::is_trivially_destructible< T >::value, "Arena elements are never destroyed" );
+
+    return static_cast< T * >( allocateBytes( (qint64)count * sizeof( T ) ) );
+} // Arena::allocate( uint count )
+
+#endif // ARENA_H
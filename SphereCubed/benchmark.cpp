@@ -0,0 +1,199 @@
+/*! \file benchmark.cpp
+\brief Benchmark class implementation file.
+This file contains the Benchmark class implementation for the application.
+*/
+
+// benchmark.h header file required for Benchmark class definition.
+#include "benchmark.h"
+
+// QElapsedTimer header file required for frame timing.
+#include <QElapsedTimer>
+// QOffscreenSurface header file required for a window less OpenGL surface.
+#include <QOffscreenSurface>
+// QOpenGLContext header file required for the OpenGL context.
+#include <QOpenGLContext>
+// QOpenGLFramebufferObject header file required for offscreen rendering.
+#include <QOpenGLFramebufferObject>
+// QtMath header file required for the spline path.
+#include <QtMath>
+
+// algorithm header file required for sorting.
+#include <algorithm>
+
+// settings.h header file required for application settings.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The Benchmark execution begins here.
+//! Create a Benchmark with its own World.
+Benchmark::Benchmark() :
+    mWorld( ENGINE_TICK_INTERVAL ),
+    mOut( stdout )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Benchmark::Benchmark()...";
+} // Benchmark::Benchmark()
+
+//! The Benchmark execution ends here.
+//! Destroy the Benchmark.
+Benchmark::~Benchmark()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Benchmark::~Benchmark()...";
+} // Benchmark::~Benchmark()
+
+//! Run the Benchmark on a Level.
+//! \param levelIndex is the Level index to render.
+//! \param frames is the number of frames to render.
+//! \return int is the process exit status, zero on success.
+int Benchmark::run( uint levelIndex, uint frames )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Benchmark::run()...";
+
+    //! Request a context with vsync off, the framebuffer object is never presented anyway.
+    QSurfaceFormat format;
+    format.setDepthBufferSize( 24 );
+    format.setSwapInterval( 0 );
+
+    //! Create a window less surface, this works under Xvfb and surfaceless EGL.
+    QOffscreenSurface surface;
+    surface.setFormat( format );
+    surface.create();
+
+    QOpenGLContext context;
+    context.setFormat( format );
+
+    if( context.create() == false || context.makeCurrent( &surface ) == false )
+    {
+        mOut << "Unable to create an OpenGL context" << endl;
+        return 1;
+    }
+
+    //! Render into a framebuffer object the size of the default window.
+    QOpenGLFramebufferObject fbo( WINDOW_WIDTH, WINDOW_HEIGHT, QOpenGLFramebufferObject::CombinedDepthStencil );
+    fbo.bind();
+
+    Camera & camera = mWorld.camera();
+    Level  & level  = mWorld.level();
+    Player & player = mWorld.player();
+
+    //! Load the Level and park the Player at the start position.
+    level.levelIndex() = levelIndex;
+    level.load();
+
+    if( level.cubeColumns() == 0 )
+    {
+        mOut << "Unable to load level " << levelIndex << endl;
+        return 1;
+    }
+
+    player.load();
+    player.position() = level.startPosition();
+    player.tick();
+    mWorld.light().target() = player.position();
+
+    //! Bring the Camera into the play State at the framebuffer size.
+    camera.resize( WINDOW_WIDTH, WINDOW_HEIGHT );
+    camera.start();
+    camera.setPlay( true );
+    camera.tick();
+
+    //! Build a closed loop of control points circling the Level at varying heights.
+    QVector3D center( level.cubeColumns() / 2.0f, 0.0f, level.cubeRows() / 2.0f );
+    float radius = qMax( level.cubeColumns(), level.cubeRows() ) * 0.6f + 2.0f;
+    QVector<QVector3D> eyes;
+    QVector<QVector3D> foci;
+
+    for( int i = 0; i < 8; i++ )
+    {
+        float angle = i * ( 2.0f * M_PI / 8.0f );
+        eyes.append( center + QVector3D( radius * qCos( angle ), ( i % 2 ) ? 6.0f : 14.0f, radius * qSin( angle ) ) );
+        foci.append( center + QVector3D( radius * 0.3f * qCos( angle * 2.0f ), 0.0f, radius * 0.3f * qSin( angle * 2.0f ) ) );
+    } // for( int i = 0; i < 8; i++ )
+
+    //! Render the frames as fast as possible.
+    QVector<qint64> frameTimes;
+    frameTimes.reserve( frames );
+
+    QElapsedTimer total;
+    QElapsedTimer timer;
+    total.start();
+
+    for( uint frame = 0; frame < frames; frame++ )
+    {
+        timer.start();
+
+        //! Move the Camera along the spline.
+        float t = ( frame * eyes.size() ) / (float)frames;
+        camera.eye()       = spline( eyes, t );
+        camera.focus()     = spline( foci, t );
+        camera.direction() = QVector3D( 0, 1, 0 );
+
+        //! Render the scene the same way the play State does.
+        camera.render();
+        level.render( camera, mWorld.light() );
+        player.render( camera, mWorld.light() );
+
+        //! Wait for the GPU so the frame time covers the whole frame.
+        glFinish();
+
+        frameTimes.append( timer.nsecsElapsed() );
+    } // for( uint frame = 0; frame < frames; frame++ )
+
+    qint64 elapsed = total.nsecsElapsed();
+
+    //! Release the OpenGL resources while the context is still current.
+    player.unload();
+    level.unload();
+    fbo.release();
+    context.doneCurrent();
+
+    if( frameTimes.isEmpty() )
+    {
+        mOut << "No frames rendered" << endl;
+        return 1;
+    }
+
+    //! Report the frame time distribution.
+    std::sort( frameTimes.begin(), frameTimes.end() );
+
+    auto percentile = [ &frameTimes ]( int percent )
+    {
+        int rank = ( ( frameTimes.size() - 1 ) * percent + 50 ) / 100;
+        return QString::number( frameTimes[rank] / 1000000.0, 'f', 3 );
+    };
+
+    mOut << "Level " << levelIndex << ": " << frameTimes.size() << " frames, "
+         << QString::number( frameTimes.size() * 1000000000.0 / elapsed, 'f', 1 ) << " fps" << endl;
+    mOut << "frame mS: average " << QString::number( elapsed / 1000000.0 / frameTimes.size(), 'f', 3 )
+         << " min " << percentile( 0 )
+         << " median " << percentile( 50 )
+         << " p95 " << percentile( 95 )
+         << " p99 " << percentile( 99 )
+         << " max " << percentile( 100 ) << endl;
+
+    return 0;
+} // Benchmark::run( uint levelIndex, uint frames )
+
+//! Get a point on a closed Catmull-Rom spline.
+//! \param points are the spline control points.
+//! \param t is the spline parameter, the integer part selects the segment.
+//! \return QVector3D is the point on the spline.
+QVector3D Benchmark::spline( const QVector<QVector3D> & points, float t )
+{
+    int count = points.size();
+    int segment = (int)t;
+    float u = t - segment;
+
+    const QVector3D & p0 = points[ ( segment + count - 1 ) % count ];
+    const QVector3D & p1 = points[ segment % count ];
+    const QVector3D & p2 = points[ ( segment + 1 ) % count ];
+    const QVector3D & p3 = points[ ( segment + 2 ) % count ];
+
+    return 0.5f * ( ( 2.0f * p1 ) +
+                    ( -p0 + p2 ) * u +
+                    ( 2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 ) * u * u +
+                    ( -p0 + 3.0f * p1 - 3.0f * p2 + p3 ) * u * u * u );
+} // Benchmark::spline( const QVector<QVector3D> & points, float t )
@@ -0,0 +1,51 @@
+/*! \file benchmark.h
+\brief Benchmark class declaration file.
+This file contains the Benchmark class declaration for the application.
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for the camera spline.
+#include <QVector>
+// QVector3D header file required for the camera spline.
+#include <QVector3D>
+
+// world.h header file required for World access.
+#include "world.h"
+
+//! Benchmark class.
+/*!
+This class declaration encapsulates the rendering Benchmark functionality.
+A Level is loaded into an offscreen framebuffer object with the Player parked at the
+start position, and the Camera is flown along a scripted spline while frames are
+rendered as fast as possible.
+*/
+class Benchmark
+{
+public: // Constructors / Destructors
+    //! Benchmark class constructor.
+    Benchmark();
+
+    //! Benchmark class destructor.
+    ~Benchmark();
+
+public: // Member Functions
+    //! Called to run the Benchmark on a Level.
+    int run( uint levelIndex, uint frames );
+
+private: // Member Variables
+    //! Used to store the World to render.
+    World mWorld;
+
+    //! Used to write the report.
+    QTextStream mOut;
+
+private: // Helper Functions
+    //! Called to get a point on a closed Catmull-Rom spline.
+    QVector3D spline( const QVector<QVector3D> & points, float t );
+}; // class Benchmark
+
+#endif // BENCHMARK_H
@@ -0,0 +1,57 @@
+/*! \file bus.cpp
+\brief Bus class implementation file.
+This file contains the Bus class implementation for the application.
+*/
+
+// bus.h header file required for Bus class definition.
+#include "bus.h"
+
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The Bus execution begins here.
+Bus::Bus()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Bus::Bus()...";
+} // Bus::Bus()
+
+//! The Bus execution ends here.
+Bus::~Bus()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Bus::~Bus()...";
+} // Bus::~Bus()
+
+//! Publish that the Player entered a new Level cell.
+//! \param column is the column of the cell.
+//! \param row is the row of the cell.
+//! \param type is the Cube type of the cell.
+//! \return void
+void Bus::publishEnteredCell( int column, int row, unsigned int type )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Bus::publishEnteredCell()..." << column << row << type;
+
+    //! Store the payload.
+    mCellColumn = column;
+    mCellRow    = row;
+    mCellType   = type;
+
+    //! Set the topic.
+    publish( TOPIC_ENTERED_CELL );
+} // Bus::publishEnteredCell( int column, int row, unsigned int type )
+
+//! Publish that the Player landed on a Cube.
+//! \param type is the Cube type landed on.
+//! \return void
+void Bus::publishLandedOnType( unsigned int type )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Bus::publishLandedOnType()..." << type;
+
+    //! Store the payload.
+    mLandedType = type;
+
+    //! Set the topic.
+    publish( TOPIC_LANDED_ON_TYPE );
+} // Bus::publishLandedOnType( unsigned int type )
@@ -0,0 +1,82 @@
+/*! \file bus.h
+\brief Bus class declaration file.
+This file contains the publish and subscribe Bus class declaration for the application.
+*/
+
+#ifndef BUS_H
+#define BUS_H
+
+//! Bus class.
+/*!
+This class declaration encapsulates the publish and subscribe Bus functionality.
+Publishers set topic bits and their typed payload as things happen. A StaticMachine takes
+the pending topics once per tick and only tests the Triggers subscribed to one of them,
+so a State with nothing pending costs no Trigger tests.
+*/
+class Bus
+{
+public: // Defined Types
+    //! Enumeration of the Bus topics, each is a bit so topics can be combined.
+    enum Topic
+    {
+        TOPIC_STATE_ENTERED  = 0x01, //!< - A State Machine entered a State.
+        TOPIC_REQUEST        = 0x02, //!< - A State change was requested by setting a condition flag.
+        TOPIC_LEFT_LEVEL     = 0x04, //!< - The Player left the Level bounds.
+        TOPIC_ENTERED_CELL   = 0x08, //!< - The Player entered a new Level cell, see cellColumn, cellRow and cellType.
+        TOPIC_LANDED_ON_TYPE = 0x10  //!< - The Player landed on a Cube, see landedType.
+    }; // enum Topic
+
+public: // Constructors / Destructors
+    //! Bus class constructor.
+    Bus();
+
+    //! Bus class destructor.
+    ~Bus();
+
+public: // Access Functions
+    //! Called to get the column of the last cell entered.
+    int cellColumn() const { return mCellColumn; }
+
+    //! Called to get the row of the last cell entered.
+    int cellRow() const { return mCellRow; }
+
+    //! Called to get the Cube::CubeType under the Player in the last cell entered, Hole in the air.
+    unsigned int cellType() const { return mCellType; }
+
+    //! Called to get the Cube::CubeType last landed on.
+    unsigned int landedType() const { return mLandedType; }
+
+    //! Called to get the pending topics.
+    unsigned int pending() const { return mPending; }
+
+public: // Member Functions
+    //! Called to publish a topic without a payload.
+    void publish( Topic topic ) { mPending |= topic; }
+
+    //! Called to publish that the Player entered a new Level cell.
+    void publishEnteredCell( int column, int row, unsigned int type );
+
+    //! Called to publish that the Player landed on a Cube.
+    void publishLandedOnType( unsigned int type );
+
+    //! Called to take and clear the pending topics.
+    unsigned int take() { unsigned int topics = mPending; mPending = 0; return topics; }
+
+private: // Member Variables
+    //! Used to store the pending topic bits, initialized to none.
+    unsigned int mPending = 0;
+
+    //! Used to store the column of the last cell entered.
+    int mCellColumn = -1;
+
+    //! Used to store the row of the last cell entered.
+    int mCellRow = -1;
+
+    //! Used to store the type of the Cube under the Player in the last cell entered.
+    unsigned int mCellType = 0;
+
+    //! Used to store the Cube type last landed on.
+    unsigned int mLandedType = 0;
+}; // class Bus
+
+#endif // BUS_H
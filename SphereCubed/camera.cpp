@@ -25,10 +25,9 @@ This file contains the Camera class implementation for the application.
 
 //! The CameraMenuState execution begins here.
 //! Create a CameraMenuState and pass it a reference to the Camera functionality.
-//! Passes a name for the state as a QString to the base class.
 //! \param camera is a reference to the Camera functionality.
 CameraMenuState::CameraMenuState( Camera & camera ) :
-    State( "CameraMenuState" ), mCamera( camera )
+    mCamera( camera )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "CameraMenuState::CameraMenuState( Camera & camera )...";
 } // CameraMenuState::CameraMenuState( Camera & camera )
@@ -107,7 +106,7 @@ void CameraMenuState::tick()
 //! Passes a name for the state as a QString to the base class
 //! \param camera is a reference to the Camera functionality.
 CameraPlayState::CameraPlayState( Camera & camera ) :
-    State( "CameraPlayState" ), mCamera( camera )
+    mCamera( camera )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "CameraPlayState::CameraPlayState( Camera & camera )...";
 } // CameraPlayState::CameraPlayState( Camera & camera )
@@ -229,10 +228,9 @@ void CameraPlayState::tick()
 
 //! The CameraMenuEvent execution begins here.
 //! Create a CameraMenuEvent and pass it a reference to the Camera functionality.
-//! Passes a name for the event as a QString to the base class.
 //! \param camera is a reference to the Camera functionality.
 CameraMenuEvent::CameraMenuEvent( Camera & camera ) :
-    Event( "CameraMenuEvent" ), mCamera( camera )
+    mCamera( camera )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "CameraMenuEvent::CameraMenuEvent( Camera & camera )...";
 } // CameraMenuEvent::CameraMenuEvent( Camera & camera )
@@ -245,13 +243,12 @@ CameraMenuEvent::~CameraMenuEvent()
     TraceOut( TRACE_FILE_EXECUTION ) << "CameraMenuEvent::~CameraMenuEvent()...";
 } // CameraMenuEvent::~CameraMenuEvent()
 
-//! Called periodically to check if Event occured.
-//! Class derived from Event must implement to test for event.
-//! \return State * is a pointer to the state to transition to.
-//! \sa Event, State, Machine
-State * CameraMenuEvent::test()
+//! Called by the StaticMachine to test the Trigger while a Bus topic of its TOPICS is pending.
+//! \return bool is true when the condition occurred, to transition.
+//! \sa StaticMachine, Bus
+bool CameraMenuEvent::test()
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "CameraMenuEvent::process...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "CameraMenuEvent::test()...";
 
     //! If menu equals true
     if( mCamera.getMenu() == true )
@@ -259,22 +256,21 @@ State * CameraMenuEvent::test()
         TraceOut( TRACE_FILE_EXECUTION ) << "Event occured...";
         //! The Event has been triggered so reset the condition.
         mCamera.setMenu( false );
-        //! Return the State to transition to.
-        return mpState;
+        //! Return true to transition.
+        return true;
     }
 
-    //! Else don't return a State
-    return NULL;
-}  // CameraMenuEvent::process()
+    //! Else don't transition.
+    return false;
+} // CameraMenuEvent::test()
 
 // CameraPlayEvent -------------------------------------------------------------
 
 //! The CameraPlayEvent execution begins here.
 //! Create a CameraPlayEvent and pass it a reference to the Camera functionality.
-//! Passes a name for the event as a QString to the base class.
 //! \param camera is a reference to the Camera functionality.
 CameraPlayEvent::CameraPlayEvent( Camera & camera ) :
-    Event( "CameraPlayEvent" ), mCamera( camera )
+    mCamera( camera )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "CameraPlayEvent::CameraPlayEvent( Camera & camera )...";
 } // CameraPlayEvent::CameraPlayEvent( Camera & camera )
@@ -287,13 +283,12 @@ CameraPlayEvent::~CameraPlayEvent()
     TraceOut( TRACE_FILE_EXECUTION ) << "CameraPlayEvent::~CameraPlayEvent()...";
 } // CameraPlayEvent::~CameraPlayEvent()
 
-//! Called periodically to check if Event occured.
-//! Class derived from Event must implement to test for event.
-//! \return State * is a pointer to the state to transition to.
-//! \sa Event, State, Machine
-State * CameraPlayEvent::test()
+//! Called by the StaticMachine to test the Trigger while a Bus topic of its TOPICS is pending.
+//! \return bool is true when the condition occurred, to transition.
+//! \sa StaticMachine, Bus
+bool CameraPlayEvent::test()
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "CameraMenuEvent::process...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "CameraPlayEvent::test()...";
 
     //! If play equals true
     if( mCamera.getPlay() == true )
@@ -301,13 +296,13 @@ State * CameraPlayEvent::test()
         TraceOut( TRACE_FILE_EXECUTION ) << "Event occured...";
         //! The Event has been triggered so reset the condition.
         mCamera.setPlay( false );
-        //! Return the State to transition to.
-        return mpState;
+        //! Return true to transition.
+        return true;
     }
 
-    //! Else don't return a State
-    return NULL;
-} // CameraPlayEvent::process()
+    //! Else don't transition.
+    return false;
+} // CameraPlayEvent::test()
 
 
 
@@ -317,14 +312,10 @@ State * CameraPlayEvent::test()
 
 //! The Camera execution begins here.
 //! Create a Camera.
-//! Passes a name for the Machine as a QString to the base class.
 Camera::Camera() :
-    Machine( "Camera" )
+    mMachine( *this )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Camera::Camera()...";
-
-    //! Configure the Camera State Machine
-    configure();
 } // Camera::Camera()
 
 //! The Machine execution ends here.
@@ -335,66 +326,6 @@ Camera::~Camera()
     TraceOut( TRACE_FILE_EXECUTION ) << "Camera::~Camera()...";
 } // Camera::~Camera()
 
-//! Called to configure the Camera Machine.
-//! \return void
-//! \sa Event, State, Machine
-void Camera::configure()
-{
-    TraceOut( TRACE_FILE_EXECUTION ) << "Camera::configure()...";
-
-    //! Create States.
-
-    //! Create CameraMenuState.
-    CameraMenuState * pCameraMenuState = new CameraMenuState( *this );
-    //! Create CameraPlayState.
-    CameraPlayState * pCameraPlayState = new CameraPlayState( *this );
-
-
-    //! Create Events.
-
-    //! Create CameraMenuEvent.
-    CameraMenuEvent * pCameraMenuEvent = new CameraMenuEvent( *this );
-    //! Create CameraPlayEvent.
-    CameraPlayEvent * pCameraPlayEvent = new CameraPlayEvent( *this );
-
-
-    //! Set Event Transitiions.
-
-    //! Set CameraMenuEvent transitiions to CameraMenuState.
-    pCameraMenuEvent->setTransitionState( pCameraMenuState );
-    //! Set CameraPlayEvent transitiions to CameraPlayState.
-    pCameraPlayEvent->setTransitionState( pCameraPlayState );
-
-
-    //! Add Events to the States.
-
-    //! Add CameraMenuEvent to CameraMenuState.
-    pCameraMenuState->addEvent( pCameraMenuEvent );
-    //! Add CameraPlayEvent to CameraMenuState.
-    pCameraMenuState->addEvent( pCameraPlayEvent );
-    //! Add CameraMenuEvent to CameraPlayState.
-    pCameraPlayState->addEvent( pCameraMenuEvent );
-
-
-    //! Add Events to Machine so it can release resources when destructed.
-
-    //! Add CameraMenuEvent.
-    addEvent( pCameraMenuEvent );
-    //! Add CameraPlayEvent.
-    addEvent( pCameraPlayEvent );
-
-    //! Add States to Machine so it can release resources when destructed.
-
-    //! Add CameraMenuState.
-    addState( pCameraMenuState );
-    //! Add CameraPlayState.
-    addState( pCameraPlayState );
-
-
-    //! Set the start State.
-    setStartState( pCameraMenuState );
-} // Camera::configure()
-
 //! Calculate the OpenGL projection matrix.
 //! \return void
 //! \sa Camera
@@ -8,15 +8,19 @@ This file contains the Camera class declaration for the application.
 
 // QMatrix4x4 header file required for model, view, projection matrices.
 #include <QMatrix4x4>
+// QSize header file required for the window size.
+#include <QSize>
 // QVector3D header file required for positioning.
 #include <QVector3D>
 
+// bus.h header file required for the Camera Bus.
+#include "bus.h"
 // frustum.h header file required for bounding Frustum class definition.
 #include "frustum.h"
-// machine.h header file required for Machine class definition.
-#include "machine.h"
 // settings.h header file required for application settings.
 #include "settings.h"
+// staticmachine.h header file required for StaticMachine class definition.
+#include "staticmachine.h"
 
 // Pre-declared calss
 class Camera;
@@ -29,10 +33,10 @@ class Camera;
 /*!
 This class declaration encapsulates the CameraMenuState functionality.
 */
-class CameraMenuState : public State
+class CameraMenuState
 {
-    //! Friend of Camera so that only Camera can instantiate the CameraMenuState.
-    friend class Camera;
+    //! Friend of StaticMachine so that only the Camera StaticMachine can instantiate the CameraMenuState.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! CameraMenuState class constructor.
@@ -43,16 +47,16 @@ private: // Constructors / Destructors
 
 private: // Member Function
     //! Triggered when entering.
-    virtual void enter();
+    void enter();
 
     //! Triggered when exiting.
-    virtual void exit();
+    void exit();
 
     //! Triggered after a tick or when ever scene needs to be rendered.
-    virtual void render();
+    void render();
 
     //! Triggered periodically.
-    virtual void tick();
+    void tick();
 
 private: // Member Variables
     //! Used to reference the Camera functionality.
@@ -63,10 +67,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the CameraPlayState functionality.
 */
-class CameraPlayState : public State
+class CameraPlayState
 {
-    //! Friend of Camera so that only Camera can instantiate the CameraPlayState.
-    friend class Camera;
+    //! Friend of StaticMachine so that only the Camera StaticMachine can instantiate the CameraPlayState.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! CameraPlayState class constructor.
@@ -77,16 +81,16 @@ private: // Constructors / Destructors
 
 private: // Member Function
     //! Triggered when entering.
-    virtual void enter();
+    void enter();
 
     //! Triggered when exiting.
-    virtual void exit();
+    void exit();
 
     //! Triggered after a tick or when ever scene needs to be rendered.
-    virtual void render();
+    void render();
 
     //! Triggered periodically.
-    virtual void tick();
+    void tick();
 
 private: // Member Variables
     //! Used to reference the Camera functionality.
@@ -103,10 +107,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the CameraMenuEvent functionality.
 */
-class CameraMenuEvent : public Event
+class CameraMenuEvent
 {
-    //! Friend of Camera so that only Camera can instantiate the CameraMenuEvent.
-    friend class Camera;
+    //! Friend of StaticMachine so that only the Camera StaticMachine can instantiate the CameraMenuEvent.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! CameraMenuEvent class constructor.
@@ -115,9 +119,13 @@ private: // Constructors / Destructors
     //! CameraMenuEvent class destructor.
     ~CameraMenuEvent();
 
+private: // Data Constants
+    //! The Bus topics that can change the test result, the menu condition being set.
+    static const unsigned int TOPICS = Bus::TOPIC_REQUEST | Bus::TOPIC_STATE_ENTERED;
+
 private: // Member Function
-    //! Test Event condition triggered.
-    virtual State * test();
+    //! Called to test the Trigger condition, true to transition.
+    bool test();
 
 private: // Member Variables
     //! Used to reference the Camera functionality.
@@ -128,10 +136,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the CameraPlayEvent functionality.
 */
-class CameraPlayEvent : public Event
+class CameraPlayEvent
 {
-    //! Friend of Camera so that only Camera can instantiate the CameraPlayEvent.
-    friend class Camera;
+    //! Friend of StaticMachine so that only the Camera StaticMachine can instantiate the CameraPlayEvent.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! CameraPlayEvent class constructor.
@@ -140,9 +148,13 @@ private: // Constructors / Destructors
     //! CameraPlayEvent class destructor.
     ~CameraPlayEvent();
 
+private: // Data Constants
+    //! The Bus topics that can change the test result, the play condition being set.
+    static const unsigned int TOPICS = Bus::TOPIC_REQUEST | Bus::TOPIC_STATE_ENTERED;
+
 private: // Member Function
-    //! Test Event condition triggered.
-    virtual State * test();
+    //! Called to test the Trigger condition, true to transition.
+    bool test();
 
 private: // Member Variables
     //! Used to reference the Camera functionality.
@@ -161,7 +173,7 @@ private: // Member Variables
 This class declaration encapsulates the Camera functionality.
 The World instantiates a Camera to manage the Camera State Machine.
 */
-class Camera : public Machine
+class Camera
 {
     //! Friend of World so that only World can instantiate the Camera.
     friend class World;
@@ -182,6 +194,11 @@ public: // Member Functions
     //! \sa Camera
     float & anglePitch() { return mCameraAnglePitch; }
 
+    //! Access function to get reference to the Camera Bus.
+    //! \return Bus reference to the topics published for the Camera State Machine.
+    //! \sa Bus
+    Bus & bus() { return mBus; }
+
     //! Access function to get/set Camera yaw angle.
     //! \return float reference to the Camera yaw angle in degrees.
     //! \sa Camera
@@ -204,6 +221,11 @@ public: // Member Functions
     //! \sa Camera
     QVector3D& eye() { return mCameraEye; }
 
+    //! Const access function to get Camera position.
+    //! \return const QVector reference to the Camera position.
+    //! \sa Camera
+    const QVector3D& eye() const { return mCameraEye; }
+
     //! Access function to get Camera position of focus.
     //! \return QVector reference to the Camera position of focus.
     //! \sa Camera
@@ -219,6 +241,15 @@ public: // Member Functions
     //! \sa Camera
     bool getPlay() { return mPlay; }
 
+    //! Call to render the Camera.
+    void render() { mMachine.render(); }
+
+    //! Call once to start the Camera before calling tick.
+    void start() { mMachine.start(); }
+
+    //! Call periodically to update the Camera.
+    void tick() { mMachine.tick(); }
+
     //! Access function to setup the projection matrix for the currently selceted rendering mode.
     //! \return void
     //! \sa Camera
@@ -243,12 +274,12 @@ public: // Member Functions
     //! Access function to set the Camera Menu condition trigger.
     //! \param value is the state to set trigger to.
     //! \sa Camera
-    void setMenu( bool value ) { mMenu = value; }
+    void setMenu( bool value ) { mMenu = value; if( value ) { mBus.publish( Bus::TOPIC_REQUEST ); } }
 
     //! Access function to set the Camera Play condition trigger.
     //! \param value is the state to set trigger to.
     //! \sa Camera
-    void setPlay( bool value ) { mPlay = value; }
+    void setPlay( bool value ) { mPlay = value; if( value ) { mBus.publish( Bus::TOPIC_REQUEST ); } }
 
     //! Access function to set the Camera Projectmode.
     //! \param mode is the enumerated mode to configure the projection matrix.
@@ -296,11 +327,19 @@ private: // Constructors / Destructors
     //! Camera class destructor.
     ~Camera();
 
-private: // Member Function
-    //! Configure the Machine.
-    void configure();
+private: // Data Types
+    //! The Camera State Machine, CameraMenuState is the start State.
+    typedef StaticMachine< Camera,
+        TypeList< CameraMenuState,
+                  CameraPlayState >,
+        TypeList< Transition< CameraMenuState, CameraMenuEvent, CameraMenuState >,
+                  Transition< CameraMenuState, CameraPlayEvent, CameraPlayState >,
+                  Transition< CameraPlayState, CameraMenuEvent, CameraMenuState > > > CameraMachine;
 
 private: // Member Variables
+    //! Used to store the Camera Bus, declared before the Camera State Machine that takes from it.
+    Bus mBus;
+
     //! Used to store the Camera yaw angle, initialize to default setting.
     float mCameraAngleYaw = CAMERA_ANGLE_YAW;
 
@@ -354,6 +393,9 @@ private: // Member Variables
 
     //! Used to store the width and height of the application window.
     QSize mWindowSize;
+
+    //! Used to run the Camera State Machine.
+    CameraMachine mMachine;
 }; // class Camera
 
 #endif // CAMERA_H
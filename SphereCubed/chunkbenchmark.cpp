@@ -0,0 +1,152 @@
+/*! \file chunkbenchmark.cpp
+\brief ChunkBenchmark class implementation file.
+This file contains the ChunkBenchmark class implementation for the application.
+*/
+
+// chunkbenchmark.h header file required for ChunkBenchmark class definition.
+#include "chunkbenchmark.h"
+
+// QElapsedTimer header file required for timing the lookups.
+#include <QElapsedTimer>
+// QFileInfo header file required for the chunk file size.
+#include <QFileInfo>
+// QVector header file required for the lookup positions and the cell arrays.
+#include <QVector>
+
+// random header file required for the seeded lookup positions.
+#include <random>
+
+// chunkstore.h header file required for ChunkStore class definition.
+#include "chunkstore.h"
+// settings.h header file required for the lookup window.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Bytes of text per cell of a Level file, 0xTT:0xHH and a separator.
+#define CHUNK_BENCHMARK_TEXT_BYTES 10
+
+//! The ChunkBenchmark execution begins here.
+ChunkBenchmark::ChunkBenchmark() :
+    mOut( stdout )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "ChunkBenchmark::ChunkBenchmark()...";
+} // ChunkBenchmark::ChunkBenchmark()
+
+//! The ChunkBenchmark execution ends here.
+ChunkBenchmark::~ChunkBenchmark()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "ChunkBenchmark::~ChunkBenchmark()...";
+} // ChunkBenchmark::~ChunkBenchmark()
+
+//! Run the ChunkBenchmark on a chunk file.
+//! \param path is the chunk file path.
+//! \param lookups is the number of random cell lookups to time in each layout.
+//! \return int is the process exit status, zero on success.
+int ChunkBenchmark::run( const QString & path, uint lookups )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "ChunkBenchmark::run()...";
+
+    if( lookups == 0 )
+    {
+        mOut << "No lookups to run" << endl;
+        return 1;
+    } // if( lookups == 0 )
+
+    //! Open the chunk file twice, decoding the chunks and keeping them encoded.
+    ChunkStore decoded( path, false );
+    ChunkStore packed( path, true );
+
+    if( ChunkStore::isChunkFile( path ) == false || decoded.open() == false || packed.open() == false )
+    {
+        mOut << "Unable to open chunk file " << path << endl;
+        return 1;
+    } // if( ChunkStore::isChunkFile( path ) == false ... )
+
+    //! Compare the sizes of the layouts.
+    qint64 cells = (qint64)decoded.columns() * decoded.rows();
+    qint64 file  = QFileInfo( path ).size();
+
+    mOut << decoded.columns() << "x" << decoded.rows() << " level, " << cells << " cells" << endl;
+    mOut << "Text:   " << cells * CHUNK_BENCHMARK_TEXT_BYTES << " bytes" << endl;
+    mOut << "Dense:  " << cells * 3 << " bytes" << endl;
+    mOut << "Chunks: " << file << " bytes, "
+         << QString::number( (double)cells * 3 / file, 'f', 1 ) << "x smaller than dense, "
+         << QString::number( (double)cells * CHUNK_BENCHMARK_TEXT_BYTES / file, 'f', 1 ) << "x smaller than text" << endl;
+
+    //! Look up random cells of a window in the middle of the Level, small enough for its
+    //! chunks to stay resident, so the lookups and not the reads are timed.
+    uint columns = qMin( (uint)CHUNK_BENCHMARK_WINDOW, decoded.columns() );
+    uint rows    = qMin( (uint)CHUNK_BENCHMARK_WINDOW, decoded.rows() );
+    uint originX = ( decoded.columns() - columns ) / 2;
+    uint originZ = ( decoded.rows() - rows ) / 2;
+
+    std::mt19937 random( 1 );
+    QVector< uint > positions( lookups );
+    for( uint i = 0; i < lookups; i++ )
+    {
+        positions[ i ] = random() % ( columns * rows );
+    }
+
+    //! Copy the window into packed cell arrays, the dense layout.
+    QVector< quint8 > heights( columns * rows );
+    QVector< quint8 > types( columns * rows );
+    QVector< quint8 > faces( columns * rows );
+    decoded.copy( originX, originZ, columns, rows, heights.data(), types.data(), faces.data() );
+
+    QElapsedTimer timer;
+    uint denseSum = 0;
+    uint decodedSum = 0;
+    uint packedSum = 0;
+
+    //! Time the dense layout.
+    timer.start();
+    for( uint i = 0; i < lookups; i++ )
+    {
+        denseSum += heights[ positions[ i ] ] + types[ positions[ i ] ];
+    }
+    qint64 denseTime = timer.nsecsElapsed();
+
+    //! Time the decoded chunks, made resident by the copy.
+    timer.start();
+    for( uint i = 0; i < lookups; i++ )
+    {
+        uint x = originX + positions[ i ] % columns;
+        uint z = originZ + positions[ i ] / columns;
+        decodedSum += decoded.height( x, z ) + decoded.type( x, z );
+    }
+    qint64 decodedTime = timer.nsecsElapsed();
+
+    //! Make the window chunks resident, then time the palette encoded chunks.
+    packed.copy( originX, originZ, columns, rows, heights.data(), types.data(), faces.data() );
+    timer.start();
+    for( uint i = 0; i < lookups; i++ )
+    {
+        uint x = originX + positions[ i ] % columns;
+        uint z = originZ + positions[ i ] / columns;
+        packedSum += packed.height( x, z ) + packed.type( x, z );
+    }
+    qint64 packedTime = timer.nsecsElapsed();
+
+    //! Every layout must hold the same cells.
+    if( decodedSum != denseSum || packedSum != denseSum )
+    {
+        mOut << "Layouts diverged" << endl;
+        return 1;
+    } // if( decodedSum != denseSum || packedSum != denseSum )
+
+    mOut << lookups << " lookups in a " << columns << "x" << rows << " window" << endl;
+    mOut << "Dense:   " << QString::number( (double)denseTime / lookups, 'f', 2 ) << " nS per lookup" << endl;
+    mOut << "Decoded: " << QString::number( (double)decodedTime / lookups, 'f', 2 ) << " nS per lookup, "
+         << QString::number( (double)decodedTime / qMax( Q_INT64_C( 1 ), denseTime ), 'f', 1 ) << "x dense" << endl;
+    mOut << "Packed:  " << QString::number( (double)packedTime / lookups, 'f', 2 ) << " nS per lookup, "
+         << QString::number( (double)packedTime / qMax( Q_INT64_C( 1 ), denseTime ), 'f', 1 ) << "x dense" << endl;
+
+    decoded.report( mOut );
+    packed.report( mOut );
+
+    return 0;
+} // ChunkBenchmark::run( const QString & path, uint lookups )
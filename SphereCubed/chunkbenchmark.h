@@ -0,0 +1,39 @@
+/*! \file chunkbenchmark.h
+\brief ChunkBenchmark class declaration file.
+This file contains the ChunkBenchmark class declaration for the application.
+*/
+
+#ifndef CHUNKBENCHMARK_H
+#define CHUNKBENCHMARK_H
+
+// QString header file required for file paths.
+#include <QString>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+
+//! ChunkBenchmark class.
+/*!
+This class declaration encapsulates the chunk file ChunkBenchmark functionality.
+The size of a chunk file is compared with the text Level file and the packed cell arrays
+it replaces, and the cost of random cell lookups in a window of the Level is timed on
+the packed cell arrays, on the decoded chunks and on the palette encoded chunks.
+*/
+class ChunkBenchmark
+{
+public: // Constructors / Destructors
+    //! ChunkBenchmark class constructor.
+    ChunkBenchmark();
+
+    //! ChunkBenchmark class destructor.
+    ~ChunkBenchmark();
+
+public: // Member Functions
+    //! Called to run the ChunkBenchmark on a chunk file.
+    int run( const QString & path, uint lookups );
+
+private: // Member Variables
+    //! Used to write the report.
+    QTextStream mOut;
+}; // class ChunkBenchmark
+
+#endif // CHUNKBENCHMARK_H
@@ -0,0 +1,654 @@
+/*! \file chunkstore.cpp
+\brief ChunkStore class implementation file.
+This file contains the Level ChunkStore class implementation for the application.
+*/
+
+// chunkstore.h header file required for ChunkStore class definition.
+#include "chunkstore.h"
+
+// QDataStream header file required for the chunk file header.
+#include <QDataStream>
+// QVector header file required for the row buffers.
+#include <QVector>
+
+// cstring header file required for copying the chunk rows.
+#include <cstring>
+
+// cube.h header file required for the Cube types and visible faces.
+#include "cube.h"
+// jobs.h header file required for preparing the rows in parallel.
+#include "jobs.h"
+// memory.h header file required for counting the resident chunks.
+#include "memory.h"
+// settings.h header file required for the chunk size and budget.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Chunk file magic, "SCCK".
+#define CHUNK_FILE_MAGIC        0x5343434B
+
+//! Chunk file format version.
+#define CHUNK_FILE_VERSION      2
+
+//! Size of the chunk file header in bytes, eight 32 bit values.
+#define CHUNK_FILE_HEADER_BYTES 32
+
+//! Chunk encoding stored as three raw planes.
+#define CHUNK_RAW               0
+
+//! Chunk encoding stored as a palette and packed indices.
+#define CHUNK_PALETTE           1
+
+//! Get a plane value of a cell of an encoded chunk.
+//! \param pChunk is the encoded chunk.
+//! \param size is the width and depth of the chunk in cells.
+//! \param index is the index of the cell in the chunk.
+//! \param plane is the plane, 0 for the height, 1 for the CubeType and 2 for the visible faces.
+//! \return quint8 is the plane value of the cell.
+static inline quint8 chunkValue( const quint8 * pChunk, uint size, uint index, uint plane )
+{
+    //! A raw chunk stores the planes one after the other.
+    if( pChunk[ 0 ] == CHUNK_RAW )
+    {
+        return pChunk[ 1 + plane * size * size + index ];
+    } // if( pChunk[ 0 ] == CHUNK_RAW )
+
+    //! A palette chunk stores the index of the palette entry of every cell, a uniform chunk none.
+    uint bits = pChunk[ 1 ];
+    const quint8 * pPalette = pChunk + 3;
+    uint entry = 0;
+
+    if( bits != 0 )
+    {
+        const quint8 * pIndices = pPalette + 3 * ( pChunk[ 2 ] + 1 );
+        uint bit = index * bits;
+        entry = ( pIndices[ bit >> 3 ] >> ( bit & 7 ) ) & ( ( 1u << bits ) - 1 );
+    } // if( bits != 0 )
+
+    return pPalette[ 3 * entry + plane ];
+} // chunkValue()
+
+//! The ChunkStore execution begins here.
+//! Automatically called by the Level when it prepares a chunk file.
+//! \param path is the chunk file path.
+//! \param packed is true to keep the resident chunks palette encoded.
+ChunkStore::ChunkStore( const QString & path, bool packed ) :
+    mFile( path ),
+    mPacked( packed )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "ChunkStore::ChunkStore()...";
+} // ChunkStore::ChunkStore()
+
+//! The ChunkStore execution ends here.
+//! Automatically called when the Level releases its data.
+ChunkStore::~ChunkStore()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "ChunkStore::~ChunkStore()...";
+
+    //! The resident chunks are given back with the ChunkStore.
+    foreach( const Resident & resident, mResident )
+    {
+        Memory::freed( Memory::LEVEL_CHUNKS, resident.data.size() );
+    } // foreach( const Resident & resident, mResident )
+} // ChunkStore::~ChunkStore()
+
+//! Get a plane value of a cell.
+//! \param x is the column of the cell, inside the Level.
+//! \param z is the row of the cell, inside the Level.
+//! \param plane is the plane, 0 for the height, 1 for the CubeType and 2 for the visible faces.
+//! \return quint8 is the plane value of the cell.
+quint8 ChunkStore::cell( uint x, uint z, uint plane )
+{
+    return chunkValue( chunk( x, z ), mChunkSize, ( z % mChunkSize ) * mChunkSize + ( x % mChunkSize ), plane );
+} // ChunkStore::cell( uint x, uint z, uint plane )
+
+//! Get the encoded chunk holding a cell, reading it from the chunk file when it is not
+//! resident. The chunk stays valid until the next chunk is read.
+//! \param x is the column of the cell, inside the Level.
+//! \param z is the row of the cell, inside the Level.
+//! \return const quint8 * is the encoded chunk, decoded to raw planes unless the ChunkStore is packed.
+const quint8 * ChunkStore::chunk( uint x, uint z )
+{
+    uint index = ( x / mChunkSize ) + ( z / mChunkSize ) * mChunkColumns;
+
+    //! Most lookups are in the same chunk as the last one.
+    if( mpLast != NULL && index == mLastIndex )
+    {
+        mHits++;
+        return mpLast;
+    } // if( mpLast != NULL && index == mLastIndex )
+
+    QHash< uint, Resident >::iterator found = mResident.find( index );
+
+    //! If the chunk is resident, make it the most recently used.
+    if( found != mResident.end() )
+    {
+        mHits++;
+        mRecent.splice( mRecent.begin(), mRecent, found->recent );
+        mLastIndex = index;
+        mpLast = (const quint8 *)found->data.constData();
+        return mpLast;
+    } // if( found != mResident.end() )
+
+    //! Read the chunk.
+    mMisses++;
+
+    Resident resident;
+    qint64 bytes = mOffsets[ index + 1 ] - mOffsets[ index ];
+    resident.data.resize( (int)qBound( Q_INT64_C( 0 ), bytes, (qint64)mChunkBytes + 1 ) );
+
+    //! If the chunk cannot be read, or what was read is not a well formed chunk.
+    if( bytes > mChunkBytes + 1 || mFile.seek( mOffsets[ index ] ) == false ||
+        mFile.read( resident.data.data(), bytes ) != bytes || valid( resident.data, mChunkSize ) == false )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "ChunkStore::chunk() - Invalid chunk" << index << "- Chunk file corrupt...";
+        //! The cells of a corrupt chunk are holes, a palette of a single hole.
+        mCorrupt++;
+        resident.data = QByteArray( 6, 0 );
+        resident.data[ 0 ] = CHUNK_PALETTE;
+    } // if( bytes > mChunkBytes + 1 || ... )
+    //! Else decode the chunk, unless it is kept encoded.
+    else if( mPacked == false )
+    {
+        resident.data = decode( resident.data, mChunkSize );
+    } // if( bytes > mChunkBytes + 1 || ... ) else
+
+    //! Make room for the chunk.
+    evict( resident.data.size() );
+
+    mRecent.push_front( index );
+    resident.recent = mRecent.begin();
+    found = mResident.insert( index, resident );
+    mResidentBytes += resident.data.size();
+    Memory::allocated( Memory::LEVEL_CHUNKS, resident.data.size() );
+    mPeak = qMax( mPeak, mResident.size() );
+    mPeakBytes = qMax( mPeakBytes, mResidentBytes );
+
+    mLastIndex = index;
+    mpLast = (const quint8 *)found->data.constData();
+    return mpLast;
+} // ChunkStore::chunk( uint x, uint z )
+
+//! Copy the cells of a rectangle of the Level into packed arrays, a chunk at a time.
+//! \param x is the first column of the rectangle, inside the Level.
+//! \param z is the first row of the rectangle, inside the Level.
+//! \param columns is the number of columns of the rectangle, inside the Level.
+//! \param rows is the number of rows of the rectangle, inside the Level.
+//! \param pHeight is the array of columns * rows heights to fill.
+//! \param pType is the array of columns * rows CubeTypes to fill.
+//! \param pFaces is the array of columns * rows visible face masks to fill.
+//! \return void
+void ChunkStore::copy( uint x, uint z, uint columns, uint rows, quint8 * pHeight, quint8 * pType, quint8 * pFaces )
+{
+    uint plane = mChunkSize * mChunkSize;
+
+    //! Go through the part of the rectangle in every chunk it covers.
+    for( uint row = z; row < z + rows; row = ( row / mChunkSize + 1 ) * mChunkSize )
+    {
+        uint rowEnd = qMin( z + rows, ( row / mChunkSize + 1 ) * mChunkSize );
+
+        for( uint column = x; column < x + columns; column = ( column / mChunkSize + 1 ) * mChunkSize )
+        {
+            uint columnEnd = qMin( x + columns, ( column / mChunkSize + 1 ) * mChunkSize );
+            const quint8 * pChunk = chunk( column, row );
+
+            //! Copy the lines of the part, the chunk stays valid until the next one is read.
+            for( uint line = row; line < rowEnd; line++ )
+            {
+                uint from = ( line % mChunkSize ) * mChunkSize + ( column % mChunkSize );
+                uint to   = ( line - z ) * columns + ( column - x );
+
+                //! A raw chunk line is copied, a palette chunk line is looked up cell by cell.
+                if( pChunk[ 0 ] == CHUNK_RAW )
+                {
+                    memcpy( pHeight + to, pChunk + 1 + from,             columnEnd - column );
+                    memcpy( pType   + to, pChunk + 1 + plane + from,     columnEnd - column );
+                    memcpy( pFaces  + to, pChunk + 1 + 2 * plane + from, columnEnd - column );
+                    continue;
+                } // if( pChunk[ 0 ] == CHUNK_RAW )
+
+                for( uint cell = 0; cell < columnEnd - column; cell++ )
+                {
+                    pHeight[ to + cell ] = chunkValue( pChunk, mChunkSize, from + cell, 0 );
+                    pType[ to + cell ]   = chunkValue( pChunk, mChunkSize, from + cell, 1 );
+                    pFaces[ to + cell ]  = chunkValue( pChunk, mChunkSize, from + cell, 2 );
+                } // for( uint cell = 0; cell < columnEnd - column; cell++ )
+            } // for( uint line = row; line < rowEnd; line++ )
+        } // for( uint column = x; ... )
+    } // for( uint row = z; ... )
+} // ChunkStore::copy( uint x, uint z, uint columns, uint rows, ... )
+
+//! Decode a palette encoded chunk to raw planes.
+//! \param encoded is the encoded chunk.
+//! \param size is the width and depth of the chunk in cells.
+//! \return QByteArray is the raw chunk, the encoded chunk itself when it is raw.
+QByteArray ChunkStore::decode( const QByteArray & encoded, uint size )
+{
+    const quint8 * pChunk = (const quint8 *)encoded.constData();
+
+    if( pChunk[ 0 ] == CHUNK_RAW )
+    {
+        return encoded;
+    } // if( pChunk[ 0 ] == CHUNK_RAW )
+
+    uint cells = size * size;
+    QByteArray decoded( 1 + 3 * cells, 0 );
+    decoded[ 0 ] = CHUNK_RAW;
+    quint8 * pPlanes = (quint8 *)decoded.data() + 1;
+
+    for( uint index = 0; index < cells; index++ )
+    {
+        pPlanes[ index ]             = chunkValue( pChunk, size, index, 0 );
+        pPlanes[ cells + index ]     = chunkValue( pChunk, size, index, 1 );
+        pPlanes[ 2 * cells + index ] = chunkValue( pChunk, size, index, 2 );
+    } // for( uint index = 0; index < cells; index++ )
+
+    return decoded;
+} // ChunkStore::decode( const QByteArray & encoded, uint size )
+
+//! Encode the raw planes of a chunk. The distinct cells become the palette and every cell
+//! an index of the fewest bits that can address it, a chunk of more than 256 distinct
+//! cells stays raw.
+//! \param pPlanes is the heights, CubeTypes and visible faces planes of the chunk.
+//! \param size is the width and depth of the chunk in cells.
+//! \return QByteArray is the encoded chunk.
+QByteArray ChunkStore::encode( const quint8 * pPlanes, uint size )
+{
+    uint cells = size * size;
+
+    QHash< quint32, uint > lookup;
+    QVector< quint32 > palette;
+    QVector< quint8 > indices( cells );
+    quint32 last = 0xFFFFFFFF;
+    uint entry = 0;
+
+    //! Find the palette entry of every cell, runs of the same cell are common.
+    for( uint index = 0; index < cells && palette.size() <= 256; index++ )
+    {
+        quint32 key = pPlanes[ index ] | ( pPlanes[ cells + index ] << 8 ) | ( pPlanes[ 2 * cells + index ] << 16 );
+
+        if( key != last )
+        {
+            QHash< quint32, uint >::const_iterator found = lookup.constFind( key );
+
+            if( found == lookup.constEnd() )
+            {
+                entry = palette.size();
+                lookup.insert( key, entry );
+                palette.append( key );
+            }
+            else
+            {
+                entry = found.value();
+            } // if( found == lookup.constEnd() ) else
+
+            last = key;
+        } // if( key != last )
+
+        indices[ index ] = (quint8)entry;
+    } // for( uint index = 0; ... )
+
+    //! Too many distinct cells to index in a byte, store the planes raw.
+    if( palette.size() > 256 )
+    {
+        QByteArray raw( 1 + 3 * cells, 0 );
+        raw[ 0 ] = CHUNK_RAW;
+        memcpy( raw.data() + 1, pPlanes, 3 * cells );
+        return raw;
+    } // if( palette.size() > 256 )
+
+    //! Pick the fewest bits that index the palette without an index straddling two bytes.
+    uint bits = ( palette.size() <= 1 ) ? 0 : ( palette.size() <= 2 ) ? 1 : ( palette.size() <= 4 ) ? 2 : ( palette.size() <= 16 ) ? 4 : 8;
+
+    QByteArray encoded( 3 + 3 * palette.size() + ( cells * bits + 7 ) / 8, 0 );
+    quint8 * pEncoded = (quint8 *)encoded.data();
+    pEncoded[ 0 ] = CHUNK_PALETTE;
+    pEncoded[ 1 ] = (quint8)bits;
+    pEncoded[ 2 ] = (quint8)( palette.size() - 1 );
+
+    for( int i = 0; i < palette.size(); i++ )
+    {
+        pEncoded[ 3 + 3 * i ]     = (quint8)( palette[ i ] );
+        pEncoded[ 3 + 3 * i + 1 ] = (quint8)( palette[ i ] >> 8 );
+        pEncoded[ 3 + 3 * i + 2 ] = (quint8)( palette[ i ] >> 16 );
+    } // for( int i = 0; i < palette.size(); i++ )
+
+    //! Pack the indices, the first cell in the lowest bits of a byte.
+    if( bits != 0 )
+    {
+        quint8 * pIndices = pEncoded + 3 + 3 * palette.size();
+
+        for( uint index = 0; index < cells; index++ )
+        {
+            uint bit = index * bits;
+            pIndices[ bit >> 3 ] |= (quint8)( indices[ index ] << ( bit & 7 ) );
+        } // for( uint index = 0; index < cells; index++ )
+    } // if( bits != 0 )
+
+    return encoded;
+} // ChunkStore::encode( const quint8 * pPlanes, uint size )
+
+//! Evict the least recently used chunks until a chunk fits in the memory budget.
+//! \param bytes is the size of the chunk to make room for.
+//! \return void
+void ChunkStore::evict( qint64 bytes )
+{
+    while( mResident.isEmpty() == false && mResidentBytes + bytes > LEVEL_CHUNK_BUDGET )
+    {
+        uint oldest = mRecent.back();
+        mRecent.pop_back();
+        qint64 oldestBytes = mResident.find( oldest )->data.size();
+        mResidentBytes -= oldestBytes;
+        Memory::freed( Memory::LEVEL_CHUNKS, oldestBytes );
+        mResident.remove( oldest );
+        mEvictions++;
+
+        //! The last chunk used is gone.
+        if( oldest == mLastIndex )
+        {
+            mpLast = NULL;
+        } // if( oldest == mLastIndex )
+    } // while( mResident.isEmpty() == false && ... )
+} // ChunkStore::evict( qint64 bytes )
+
+//! Check to see if a file is a chunk file by its magic.
+//! \param path is the file path.
+//! \return bool is true if the file starts with the chunk file magic.
+bool ChunkStore::isChunkFile( const QString & path )
+{
+    QFile file( path );
+
+    if( file.open( QIODevice::ReadOnly ) == false )
+    {
+        return false;
+    } // if( file.open( QIODevice::ReadOnly ) == false )
+
+    QDataStream stream( &file );
+    quint32 magic = 0;
+    stream >> magic;
+
+    return ( stream.status() == QDataStream::Ok && magic == CHUNK_FILE_MAGIC );
+} // ChunkStore::isChunkFile( const QString & path )
+
+//! Open the chunk file and read its header, no chunk is read until a cell is looked up.
+//! \return bool is true on success.
+bool ChunkStore::open()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "ChunkStore::open()...";
+
+    if( mFile.open( QIODevice::ReadOnly ) == false )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "ChunkStore::open() - Unable to open chunk file...";
+        return false;
+    } // if( mFile.open( QIODevice::ReadOnly ) == false )
+
+    //! Read the header.
+    QDataStream stream( &mFile );
+    quint32 magic, version, columns, rows, chunkSize, startX, startY, startZ;
+    stream >> magic >> version >> columns >> rows >> chunkSize >> startX >> startY >> startZ;
+
+    //! Verify the header.
+    if( stream.status() != QDataStream::Ok || magic != CHUNK_FILE_MAGIC || version != CHUNK_FILE_VERSION ||
+        columns == 0 || rows == 0 || chunkSize == 0 || chunkSize > 0x400 )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "ChunkStore::open() - Invalid header - Chunk file corrupt...";
+        //! If the header is invalid Assert to alert of issue.
+        Q_ASSERT_X( false, "Invalid Chunk File Header.", "Chunk File Corrupted." );
+        return false;
+    } // if( stream.status() != QDataStream::Ok || ... )
+
+    mColumns       = columns;
+    mRows          = rows;
+    mChunkSize     = chunkSize;
+    mChunkColumns  = ( columns + chunkSize - 1 ) / chunkSize;
+    mChunkBytes    = 3 * chunkSize * chunkSize;
+    mStartPosition = QVector3D( startX, startY, startZ );
+
+    //! Read the chunk offsets table.
+    uint chunkCount = mChunkColumns * ( ( rows + chunkSize - 1 ) / chunkSize );
+    mOffsets.resize( chunkCount + 1 );
+
+    for( uint index = 0; index <= chunkCount; index++ )
+    {
+        quint64 offset;
+        stream >> offset;
+        mOffsets[ index ] = (qint64)offset;
+    } // for( uint index = 0; index <= chunkCount; index++ )
+
+    //! Verify the offsets are in order and inside the file, the contents of a chunk are verified when it is read.
+    bool valid = ( stream.status() == QDataStream::Ok &&
+                   mOffsets[ 0 ] >= CHUNK_FILE_HEADER_BYTES + 8 * ( (qint64)chunkCount + 1 ) &&
+                   mOffsets[ chunkCount ] <= mFile.size() );
+
+    for( uint index = 0; valid == true && index < chunkCount; index++ )
+    {
+        valid = ( mOffsets[ index ] <= mOffsets[ index + 1 ] );
+    } // for( uint index = 0; valid == true && index < chunkCount; index++ )
+
+    if( valid == false )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "ChunkStore::open() - Invalid offsets - Chunk file corrupt...";
+        //! If the offsets are invalid Assert to alert of issue.
+        Q_ASSERT_X( false, "Invalid Chunk Offsets.", "Chunk File Corrupted." );
+        return false;
+    } // if( valid == false )
+
+    return true;
+} // ChunkStore::open()
+
+//! Report the chunk cache counters.
+//! \param out is the stream to report to.
+//! \return void
+void ChunkStore::report( QTextStream & out )
+{
+    qint64 encoded = mOffsets.last() - mOffsets.first();
+    qint64 raw = (qint64)( mOffsets.size() - 1 ) * mChunkBytes;
+
+    out << "chunks: " << mColumns << "x" << mRows << " cells in " << mChunkSize << "x" << mChunkSize
+        << " chunks, " << encoded << " bytes encoded for " << raw << " bytes raw, ratio "
+        << QString::number( (double)raw / qMax( Q_INT64_C( 1 ), encoded ), 'f', 1 ) << ":1" << endl;
+
+    out << "chunks: " << ( mPacked ? "packed" : "decoded" ) << ", " << mResident.size() << " resident in "
+        << mResidentBytes << " bytes, peak " << mPeak << " in " << mPeakBytes << " bytes of a budget of "
+        << LEVEL_CHUNK_BUDGET << ", " << mHits << " hits, " << mMisses << " reads, " << mEvictions << " evictions, "
+        << mCorrupt << " corrupt" << endl;
+} // ChunkStore::report( QTextStream & out )
+
+//! Check to see if an encoded chunk is well formed, so its cells can be looked up without
+//! reading past it: a raw chunk holds the three planes, a palette chunk an index width that
+//! does not straddle a byte, its palette and the indices of every cell, each in the palette.
+//! \param encoded is the encoded chunk.
+//! \param size is the width and depth of the chunk in cells.
+//! \return bool is true if the chunk is well formed.
+bool ChunkStore::valid( const QByteArray & encoded, uint size )
+{
+    const quint8 * pChunk = (const quint8 *)encoded.constData();
+    qint64 cells = (qint64)size * size;
+
+    //! A raw chunk is the encoding and the three planes.
+    if( encoded.isEmpty() == false && pChunk[ 0 ] == CHUNK_RAW )
+    {
+        return ( encoded.size() == 1 + 3 * cells );
+    } // if( encoded.isEmpty() == false && pChunk[ 0 ] == CHUNK_RAW )
+
+    //! Any other chunk is a palette chunk, the encoding, the index width and the last palette entry.
+    if( encoded.size() < 3 || pChunk[ 0 ] != CHUNK_PALETTE )
+    {
+        return false;
+    } // if( encoded.size() < 3 || pChunk[ 0 ] != CHUNK_PALETTE )
+
+    uint bits    = pChunk[ 1 ];
+    uint entries = pChunk[ 2 ] + 1u;
+
+    if( ( bits != 0 && bits != 1 && bits != 2 && bits != 4 && bits != 8 ) ||
+        encoded.size() != 3 + 3 * entries + ( cells * bits + 7 ) / 8 )
+    {
+        return false;
+    } // if( ( bits != 0 && ... ) || ... )
+
+    //! Every index must be an entry of the palette, unless the palette has an entry for every index.
+    if( bits != 0 && entries < ( 1u << bits ) )
+    {
+        const quint8 * pIndices = pChunk + 3 + 3 * entries;
+
+        for( qint64 index = 0; index < cells; index++ )
+        {
+            qint64 bit = index * bits;
+
+            if( ( ( pIndices[ bit >> 3 ] >> ( bit & 7 ) ) & ( ( 1u << bits ) - 1 ) ) >= entries )
+            {
+                return false;
+            } // if( ( ( pIndices[ bit >> 3 ] >> ( bit & 7 ) ) & ... ) >= entries )
+        } // for( qint64 index = 0; index < cells; index++ )
+    } // if( bits != 0 && entries < ( 1u << bits ) )
+
+    return true;
+} // ChunkStore::valid( const QByteArray & encoded, uint size )
+
+//! Write a chunk file from the rows of a Level, a band of chunk rows at a time, so only a
+//! band of rows is ever held in memory. The visible faces are computed as the rows are
+//! written, a band keeps the row before and after it for the faces on its edges. Every
+//! chunk is palette encoded when it pays.
+//! \param path is the chunk file path to write.
+//! \param columns is the number of Cube columns in the Level.
+//! \param rows is the number of Cube rows in the Level.
+//! \param rowSource is called for every row to fill its cells, some rows are asked for twice.
+//! \return bool is true on success.
+bool ChunkStore::write( const QString & path, uint columns, uint rows, const RowSource & rowSource )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "ChunkStore::write()...";
+
+    QFile file( path );
+
+    if( columns == 0 || rows == 0 || file.open( QIODevice::WriteOnly | QIODevice::Truncate ) == false )
+    {
+        return false;
+    } // if( columns == 0 || rows == 0 || ... )
+
+    uint size         = LEVEL_CHUNK_SIZE;
+    uint plane        = size * size;
+    uint chunkColumns = ( columns + size - 1 ) / size;
+    uint chunkRows    = ( rows + size - 1 ) / size;
+    uint chunkCount   = chunkColumns * chunkRows;
+
+    //! Leave room for the header and the offsets table, they are written once the start
+    //! position and the chunk sizes are known.
+    QVector< qint64 > offsets( chunkCount + 1 );
+    offsets[ 0 ] = CHUNK_FILE_HEADER_BYTES + 8 * ( (qint64)chunkCount + 1 );
+    file.write( QByteArray( (int)offsets[ 0 ], 0 ) );
+
+    //! The rows of a band are buffered from line 1, line 0 holds the row before the band and
+    //! the line after the band rows holds the row after it.
+    QVector< quint8 > types( ( size + 2 ) * columns );
+    QVector< quint8 > heights( ( size + 2 ) * columns );
+    QVector< quint8 > faces( size * columns );
+    quint8 * pTypes   = types.data();
+    quint8 * pHeights = heights.data();
+    quint8 * pFaces   = faces.data();
+
+    QVector< QByteArray > encoded( chunkColumns );
+    QByteArray * pEncoded = encoded.data();
+    QVector3D startPosition;
+
+    for( uint band = 0; band < chunkRows; band++ )
+    {
+        uint first = band * size;
+        uint count = qMin( size, rows - first );
+
+        //! Fill the band rows and their neighbours in parallel.
+        Jobs::instance().parallelFor( ( first == 0 ) ? 0 : first - 1, qMin( rows, first + count + 1 ), 1,
+                                      [ &rowSource, pTypes, pHeights, first, columns ]( uint row )
+        {
+            uint line = row + 1 - first;
+            rowSource( row, pTypes + line * columns, pHeights + line * columns );
+        } ); // Jobs::instance().parallelFor( ... )
+
+        //! Compute the visible faces of the band rows in parallel, a hole or the Level edge covers no face.
+        Jobs::instance().parallelFor( 0, count, 1, [ pTypes, pHeights, pFaces, first, columns, rows ]( uint line )
+        {
+            const quint8 * pType   = pTypes + ( line + 1 ) * columns;
+            const quint8 * pHeight = pHeights + ( line + 1 ) * columns;
+            uint row = first + line;
+
+            auto neighbour = [ pType, pHeight ]( int offset ) -> int
+            {
+                return ( pType[ offset ] == Cube::HOLE ) ? -1 : pHeight[ offset ];
+            };
+
+            for( uint x = 0; x < columns; x++ )
+            {
+                int far   = ( row == 0 )           ? -1 : neighbour( (int)x - (int)columns );
+                int near  = ( row == rows - 1 )    ? -1 : neighbour( x + columns );
+                int left  = ( x == 0 )             ? -1 : neighbour( x - 1 );
+                int right = ( x == columns - 1 )   ? -1 : neighbour( x + 1 );
+
+                pFaces[ line * columns + x ] = Cube::visibleFaces( pType[ x ], pHeight[ x ], far, near, left, right );
+            } // for( uint x = 0; x < columns; x++ )
+        } ); // Jobs::instance().parallelFor( 0, count, 1, ... )
+
+        //! Look for the start in the band rows.
+        for( uint line = 0; line < count; line++ )
+        {
+            for( uint x = 0; x < columns; x++ )
+            {
+                if( pTypes[ ( line + 1 ) * columns + x ] == Cube::START )
+                {
+                    startPosition = QVector3D( x, pHeights[ ( line + 1 ) * columns + x ] + 1, first + line );
+                } // if( pTypes[ ... ] == Cube::START )
+            } // for( uint x = 0; x < columns; x++ )
+        } // for( uint line = 0; line < count; line++ )
+
+        //! Encode the chunks of the band in parallel, the cells past the Level edge are holes.
+        Jobs::instance().parallelFor( 0, chunkColumns, 1, [ pTypes, pHeights, pFaces, pEncoded, count, columns, size, plane ]( uint chunkX )
+        {
+            uint x     = chunkX * size;
+            uint width = qMin( size, columns - x );
+
+            QVector< quint8 > planes( 3 * plane );
+            quint8 * pPlanes = planes.data();
+
+            for( uint line = 0; line < count; line++ )
+            {
+                memcpy( pPlanes + line * size,             pHeights + ( line + 1 ) * columns + x, width );
+                memcpy( pPlanes + plane + line * size,     pTypes   + ( line + 1 ) * columns + x, width );
+                memcpy( pPlanes + 2 * plane + line * size, pFaces   + line * columns + x,         width );
+            } // for( uint line = 0; line < count; line++ )
+
+            pEncoded[ chunkX ] = encode( pPlanes, size );
+        } ); // Jobs::instance().parallelFor( 0, chunkColumns, 1, ... )
+
+        //! Write the chunks of the band in order.
+        for( uint chunkX = 0; chunkX < chunkColumns; chunkX++ )
+        {
+            uint index = band * chunkColumns + chunkX;
+
+            if( file.write( encoded[ chunkX ] ) != encoded[ chunkX ].size() )
+            {
+                return false;
+            } // if( file.write( encoded[ chunkX ] ) != encoded[ chunkX ].size() )
+
+            offsets[ index + 1 ] = offsets[ index ] + encoded[ chunkX ].size();
+        } // for( uint chunkX = 0; chunkX < chunkColumns; chunkX++ )
+    } // for( uint band = 0; band < chunkRows; band++ )
+
+    //! Write the header and the offsets table now the start position and chunk sizes are known.
+    if( file.seek( 0 ) == false )
+    {
+        return false;
+    } // if( file.seek( 0 ) == false )
+
+    QDataStream stream( &file );
+    stream << (quint32)CHUNK_FILE_MAGIC << (quint32)CHUNK_FILE_VERSION << (quint32)columns << (quint32)rows << (quint32)size
+           << (quint32)startPosition.x() << (quint32)startPosition.y() << (quint32)startPosition.z();
+
+    foreach( qint64 offset, offsets )
+    {
+        stream << (quint64)offset;
+    } // foreach( qint64 offset, offsets )
+
+    return ( stream.status() == QDataStream::Ok && file.error() == QFileDevice::NoError );
+} // ChunkStore::write( const QString & path, uint columns, uint rows, const RowSource & rowSource )
@@ -0,0 +1,196 @@
+/*! \file chunkstore.h
+\brief ChunkStore class declaration file.
+This file contains the Level ChunkStore class declaration for the application.
+*/
+
+#ifndef CHUNKSTORE_H
+#define CHUNKSTORE_H
+
+// QByteArray header file required for the resident chunks.
+#include <QByteArray>
+// QFile header file required for reading the chunks on demand.
+#include <QFile>
+// QHash header file required for finding the resident chunks.
+#include <QHash>
+// QString header file required for file paths.
+#include <QString>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for the chunk offsets.
+#include <QVector>
+// QVector3D header file required for the start position.
+#include <QVector3D>
+
+// functional header file required for the RowSource type.
+#include <functional>
+// list header file required for the least recently used order.
+#include <list>
+
+//! ChunkStore class.
+/*!
+This class declaration encapsulates the Level ChunkStore functionality.
+A Level too large to hold in memory is stored in a binary chunk file of fixed size
+square tiles, the chunks, each holding the height, the CubeType and the visible face
+mask of its cells. The chunks are read on demand when a cell is looked up and kept in a
+least recently used cache within a memory budget, so only the chunks around the Player
+and the Camera are resident.
+A chunk file starts with a header, the magic, the version, the Level columns and rows,
+the chunk size and the start position, then a table of the file offset of every chunk
+in row major order, so any chunk is found in one seek. The cells past the Level edge are
+holes.
+Most chunks only use a few distinct cells, long runs of the same CubeType and height, so
+a chunk is palette encoded: the distinct cells, then a packed index of 0, 1, 2, 4 or 8
+bits per cell into them, any cell still found in constant time. A chunk of more than 256
+distinct cells is stored raw, as three planes of heights, CubeTypes and visible faces.
+The resident chunks are decoded to raw planes when they are read, or kept palette
+encoded in the packed mode so far more of a huge Level fits in the memory budget, at
+the cost of a bit extraction per lookup.
+A ChunkStore is used by one thread at a time.
+*/
+class ChunkStore
+{
+    //! Friend of ChunkBenchmark so that it can open a ChunkStore in either mode.
+    friend class ChunkBenchmark;
+
+    //! Friend of Level so that only Level can open a ChunkStore.
+    friend class Level;
+
+public: // Data Types
+    //! A RowSource fills the CubeType and height of every cell of a row, it may be called on any thread.
+    typedef std::function< void( uint row, quint8 * pType, quint8 * pHeight ) > RowSource;
+
+public: // Static Functions
+    //! Called to find out if a file is a chunk file.
+    static bool isChunkFile( const QString & path );
+
+    //! Called to write a chunk file from the rows of a Level.
+    static bool write( const QString & path, uint columns, uint rows, const RowSource & rowSource );
+
+public: // Access Functions
+    //! Called to get the number of Cube columns in the Level.
+    uint columns() const { return mColumns; }
+
+    //! Called to get the number of Cube rows in the Level.
+    uint rows() const { return mRows; }
+
+    //! Called to get the start position for the Level.
+    const QVector3D & startPosition() const { return mStartPosition; }
+
+public: // Member Functions
+    //! Called to copy the cells of a rectangle of the Level into packed arrays.
+    void copy( uint x, uint z, uint columns, uint rows, quint8 * pHeight, quint8 * pType, quint8 * pFaces );
+
+    //! Called to get the visible face mask of a cell.
+    quint8 faces( uint x, uint z ) { return cell( x, z, 2 ); }
+
+    //! Called to get the Cube height of a cell.
+    quint8 height( uint x, uint z ) { return cell( x, z, 0 ); }
+
+    //! Called to report the chunk cache counters.
+    void report( QTextStream & out );
+
+    //! Called to get the CubeType of a cell.
+    quint8 type( uint x, uint z ) { return cell( x, z, 1 ); }
+
+private: // Constructors / Destructors
+    //! ChunkStore class constructor.
+    ChunkStore( const QString & path, bool packed );
+
+    //! ChunkStore class destructor.
+    ~ChunkStore();
+
+private: // Data Types
+    //! Internal resident chunk.
+    struct Resident
+    {
+        //! - The encoded chunk, palette or raw.
+        QByteArray data;
+        //! - Position of the chunk in the least recently used order.
+        std::list< uint >::iterator recent;
+    }; // struct Resident
+
+private: // Helper Functions
+    //! Called to get a plane value of a cell.
+    quint8 cell( uint x, uint z, uint plane );
+
+    //! Called to get the encoded chunk holding a cell, reading it when not resident.
+    const quint8 * chunk( uint x, uint z );
+
+    //! Called to decode a palette encoded chunk to raw planes.
+    static QByteArray decode( const QByteArray & encoded, uint size );
+
+    //! Called to encode the raw planes of a chunk, palette encoded when it pays.
+    static QByteArray encode( const quint8 * pPlanes, uint size );
+
+    //! Called to evict the least recently used chunks until a chunk of some bytes fits the budget.
+    void evict( qint64 bytes );
+
+    //! Called to open the chunk file and read its header.
+    bool open();
+
+    //! Called to find out if an encoded chunk is well formed, its size matches its encoding.
+    static bool valid( const QByteArray & encoded, uint size );
+
+private: // Member Variables
+    //! Used to read the chunks.
+    QFile mFile;
+
+    //! Used to store the number of Cube columns in the Level.
+    uint mColumns = 0;
+
+    //! Used to store the number of Cube rows in the Level.
+    uint mRows = 0;
+
+    //! Used to store the width and depth of a chunk in cells.
+    uint mChunkSize = 0;
+
+    //! Used to store the number of chunks along X.
+    uint mChunkColumns = 0;
+
+    //! Used to store the number of bytes of the three raw planes of a chunk.
+    uint mChunkBytes = 0;
+
+    //! Used to store the file offset of every chunk, and of the end of the last one.
+    QVector< qint64 > mOffsets;
+
+    //! Used to keep the resident chunks palette encoded instead of decoding them.
+    bool mPacked;
+
+    //! Used to store the start location of the Level.
+    QVector3D mStartPosition;
+
+    //! Used to find the resident chunks by index.
+    QHash< uint, Resident > mResident;
+
+    //! Used to order the resident chunk indices, most recently used first.
+    std::list< uint > mRecent;
+
+    //! Used to store the index of the last chunk used.
+    uint mLastIndex = 0;
+
+    //! Used to store the encoded last chunk used, NULL when it was evicted.
+    const quint8 * mpLast = NULL;
+
+    //! Used to count the lookups of a resident chunk.
+    qint64 mHits = 0;
+
+    //! Used to count the chunks read.
+    qint64 mMisses = 0;
+
+    //! Used to count the chunks evicted.
+    qint64 mEvictions = 0;
+
+    //! Used to count the chunks that were unreadable or malformed, read as holes.
+    qint64 mCorrupt = 0;
+
+    //! Used to store the most chunks resident at once.
+    int mPeak = 0;
+
+    //! Used to store the bytes of the resident chunks.
+    qint64 mResidentBytes = 0;
+
+    //! Used to store the most bytes of resident chunks at once.
+    qint64 mPeakBytes = 0;
+}; // class ChunkStore
+
+#endif // CHUNKSTORE_H
@@ -6,6 +6,8 @@ This file contains the Cube class implementation for the application.
 // cube.h header file required for class definition.
 #include "cube.h"
 
+// memory.h header file required for counting the OpenGL buffers and textures.
+#include "memory.h"
 // trace.h header file required for tracing execution.
 #include "trace.h"
 
@@ -27,7 +29,7 @@ Box                     Cube::mBox( true );
 QGLBuffer               Cube::mBufferFace[ Cube::CubeFace::CUBE_FACE_COUNT ];
 bool                    Cube::mLoaded = false;
 QOpenGLShaderProgram    Cube::mProgram;
-QOpenGLTexture *        Cube::mpTexture[ Cube::CubeType::CUBE_TYPE_COUNT ];
+QOpenGLTexture *        Cube::mpTexture[ Cube::CubeType::CUBE_TYPE_COUNT ] = { NULL };
 
 //! The Cube execution begins here.
 //! Creates components to load and render a Cube.
@@ -36,19 +38,14 @@ Cube::Cube()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Cube::Cube()...";
 
-    //! Initialize all Cube Textures to NULL.
-    for( int i = 0; i < CubeType::CUBE_TYPE_COUNT; i++ ) { mpTexture[i] = NULL; }
 } // Cube::Cube()
 
 //! The Cube execution ends here.
-//! Required to free the Cube allocated memory.
-//! Automatically called when Level unload.
+//! The shared OpenGL resources are unloaded by the Level, not by the destructor, so Level
+//! data can be released without a current OpenGL context.
 Cube::~Cube()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Cube::~Cube()...";
-
-    //! Make sure to unload all Cube resources.
-    unload();
 } // Cube::~Cube()
 
 //! Load the Opengl vertex data, shader program, and texture image.
@@ -179,6 +176,7 @@ bool Cube::loadBuffers( CubeFace cubeFace )
 
     //! Allocate space for the 4 vertices with normals and texturecoordinates.
     mBufferFace[ cubeFace ].allocate(4 * (3+3+2) * sizeof(GLfloat));
+    Memory::allocated( Memory::GPU_BUFFERS, 4 * (3+3+2) * sizeof(GLfloat) );
 
     //! Transfer the vertex data to GPU memory.
     int offset = 0;
@@ -265,43 +263,49 @@ bool Cube::loadTexture( CubeType cubeType, QString texture )
         return false;
     } // if( image.isNull() == true )
 
+    //! The decoded image is held until it is uploaded.
+    Memory::allocated( Memory::TEXTURE_IMAGES, image.byteCount() );
+
     //! Attempt to allocate memory for the texture and convert the image to an OpenGL texture.
-    if( (mpTexture[ cubeType ] = new QOpenGLTexture( image )) == NULL )
+    mpTexture[ cubeType ] = new QOpenGLTexture( image );
+    Memory::freed( Memory::TEXTURE_IMAGES, image.byteCount() );
+
+    if( mpTexture[ cubeType ] == NULL )
     {
         //! If allocate texture failed Assert to alert there is an issue.
         Q_ASSERT_X( false, "Convert Image to Texture Failed", texture.toLatin1() );
         //! Return fasle without loading texture.
         return false;
-    } // if( (mpTexture[ cubeType ] = new QOpenGLTexture( image )) == NULL )
+    } // if( mpTexture[ cubeType ] == NULL )
+
+    Memory::allocated( Memory::TEXTURE_GPU, Memory::textureBytes( *mpTexture[ cubeType ] ) );
 
     //! Texture loaded successfully return true.
     return true;
 } // Cube::loadTexture( CubeType cubeType, QString texture )
 
-//! Render the Opengl resources for the Cube.
+//! Render the Opengl resources for the Cube of a cell.
 //! \param camera is a const reference to Camera viewing the scene.
 //! \param light is a const reference to the Light lightinh the scene.
+//! \param position is the position of the Cube.
+//! \param cubeType is the CubeType of the Cube.
+//! \param faces is the mask of the visible faces of the Cube.
 //! \return void
-void Cube::render( const Camera & camera, const Light & light )
+void Cube::render( const Camera & camera, const Light & light, const QVector3D & position, CubeType cubeType, quint8 faces )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Cube::render()...";
 
     //! If Cube resources are NOT loaded Assert to alert there is an issue.
     Q_ASSERT_X( mLoaded == true, "Cube::render","Resources NOT Loaded!");
 
-    //! If the Cube is not in the view of the Camera.
-    if( camera.boxViewable( mBox + mPosition ) == false )
-    {
-        //! Return without rendering.
-        return;
-    } // if( camera.boxViewable( mBox + mPosition ) == false )
+    //! The Level has already culled the Cubes not in the view of the Camera.
 
     //! It the Cube is of type Hole.
-    if( mType == CubeType::HOLE )
+    if( cubeType == CubeType::HOLE )
     {
         //! Return without rendering.
         return;
-    } // if( mType == CubeType::HOLE )
+    } // if( cubeType == CubeType::HOLE )
 
     //! Get a reference to the Camera view matrix.
     const QMatrix4x4 & viewMatrix = camera.viewMatrix();
@@ -310,7 +314,7 @@ void Cube::render( const Camera & camera, const Light & light )
     //! Create a model matrix.
     QMatrix4x4 modelMatrix;
     //! Translate the model matrix by the Cube position.
-    modelMatrix.translate( mPosition );
+    modelMatrix.translate( position );
     //! Calculate the model view matrix.
     QMatrix4x4 modelViewMatrix = viewMatrix * modelMatrix;
     //! Calculate the model view projection matrix.
@@ -342,28 +346,29 @@ void Cube::render( const Camera & camera, const Light & light )
 
     //! Set the active multitexture index to 0 and bind to it.
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, mpTexture[mType]->textureId());
+    glBindTexture(GL_TEXTURE_2D, mpTexture[cubeType]->textureId());
     glActiveTexture(0);
 
     //! Rendr the Cube faces.
-    renderFace( CubeFace::TOP );
-    renderFace( CubeFace::BOTTOM );
-    renderFace( CubeFace::LEFT );
-    renderFace( CubeFace::RIGHT );
-    renderFace( CubeFace::NEAR );
-    renderFace( CubeFace::FAR );
+    renderFace( CubeFace::TOP,    faces );
+    renderFace( CubeFace::BOTTOM, faces );
+    renderFace( CubeFace::LEFT,   faces );
+    renderFace( CubeFace::RIGHT,  faces );
+    renderFace( CubeFace::NEAR,   faces );
+    renderFace( CubeFace::FAR,    faces );
 
     //! Release the shader program.
     mProgram.release();
-} // Cube::render( const Camera & camera, const Light & light )
+} // Cube::render( const Camera & camera, const Light & light, const QVector3D & position, CubeType cubeType, quint8 faces )
 
 //! Render the Opengl resources for a face of the Cube.
 //! \param cubeFace is the face to render.
+//! \param faces is the mask of the visible faces of the Cube.
 //! \return void
-void Cube::renderFace( CubeFace cubeFace )
+void Cube::renderFace( CubeFace cubeFace, quint8 faces )
 {
     //! Determine if the face is visible.
-    if( mFace[ cubeFace ] == true )
+    if( ( faces & faceBit( cubeFace ) ) != 0 )
     {
         //! Attempt to bind to the face's buffer.
         if( mBufferFace[ cubeFace ].bind() == false )
@@ -398,10 +403,10 @@ void Cube::renderFace( CubeFace cubeFace )
         mProgram.disableAttributeArray("vertex");
         mProgram.disableAttributeArray("normal");
         mProgram.disableAttributeArray("textureCoordinate");
-    } // if( mFace[ cubeFace ] == true )
-} // Cube::renderFace( CubeFace cubeFace )
+    } // if( ( faces & faceBit( cubeFace ) ) != 0 )
+} // Cube::renderFace( CubeFace cubeFace, quint8 faces )
 
-//! Update the Cube.
+//! Update the Cubes.
 //! \return void
 void Cube::tick()
 {
@@ -427,6 +432,11 @@ void Cube::unload()
     //! Release and destroy all face buffers.
     for( int i = 0; i < CubeFace::CUBE_FACE_COUNT; i++ )
     {
+        if( mBufferFace[i].isCreated() == true )
+        {
+            Memory::freed( Memory::GPU_BUFFERS, 4 * (3+3+2) * sizeof(GLfloat) );
+        } // if( mBufferFace[i].isCreated() == true )
+
         mBufferFace[i].release();
         mBufferFace[i].destroy();
     } // for( int i = 0; i < CubeFace::CUBE_FACE_COUNT; i++ )
@@ -436,6 +446,8 @@ void Cube::unload()
     {
         if( mpTexture[i] != NULL )
         {
+            Memory::freed( Memory::TEXTURE_GPU, Memory::textureBytes( *mpTexture[i] ) );
+
             mpTexture[i]->release();
             mpTexture[i]->destroy();
 
@@ -447,3 +459,39 @@ void Cube::unload()
     //! Track that the Cube resource are NOT loaded.
     mLoaded = false;
 } // Cube::unload()
+
+//! Get the visible face mask of a Cube from the heights of its neighbours.
+//! A side face is hidden by a neighbour Cube of the same height, it is visible on the edge
+//! of the Level, next to a Hole or next to a Cube at a different height.
+//! \param cubeType is the CubeType of the Cube.
+//! \param height is the height of the Cube.
+//! \param farHeight is the height of the Cube behind, -1 for a Hole or the Level edge.
+//! \param nearHeight is the height of the Cube in front, -1 for a Hole or the Level edge.
+//! \param leftHeight is the height of the Cube to the left, -1 for a Hole or the Level edge.
+//! \param rightHeight is the height of the Cube to the right, -1 for a Hole or the Level edge.
+//! \return quint8 is the mask of the visible faces, zero for a Hole.
+quint8 Cube::visibleFaces( quint8 cubeType, int height, int farHeight, int nearHeight, int leftHeight, int rightHeight )
+{
+    //! If the cube is a Hole type, all faces are invisible.
+    if( cubeType == CubeType::HOLE )
+    {
+        return 0;
+    } // if( cubeType == CubeType::HOLE )
+
+    //! The Top face is always visible.
+    quint8 faces = faceBit( CubeFace::TOP );
+
+    //! If the Cube is higher then 1, assume the bottom is visible.
+    if( height > 1 )
+    {
+        faces |= faceBit( CubeFace::BOTTOM );
+    } // if( height > 1 )
+
+    //! A side face is visible unless the neighbour on that side covers it.
+    if( farHeight   != height ) { faces |= faceBit( CubeFace::FAR );   }
+    if( nearHeight  != height ) { faces |= faceBit( CubeFace::NEAR );  }
+    if( leftHeight  != height ) { faces |= faceBit( CubeFace::LEFT );  }
+    if( rightHeight != height ) { faces |= faceBit( CubeFace::RIGHT ); }
+
+    return faces;
+} // Cube::visibleFaces( quint8 cubeType, int height, ... )
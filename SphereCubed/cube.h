@@ -25,6 +25,10 @@ This file contains the Cube class declaration for the application.
 //! Cube class.
 /*!
 This class declaration encapsulates the Cube functionality.
+A Cube is not stored as an object. The Level keeps the height, type and visible faces of
+every cell in packed arrays, with the position implied by the cell index, and the few
+Cubes stacked apart from them as Spans, and the Cube only owns the OpenGL resources
+shared by every Cube and renders a cell from its values.
 */
 class Cube
 {
@@ -67,6 +71,26 @@ public: // Defined Types
         CUBE_FACE_COUNT
     }; // enum CubeFace
 
+    //! A vertical run of Cubes of one CubeType in a cell, apart from the Cube of the cell,
+    //! for the bridges, tunnels and overhangs of a Level.
+    struct Span
+    {
+        //! - Index of the cell, its column and row are implied.
+        quint32 cell;
+        //! - CubeType of the Cubes.
+        quint8 type;
+        //! - Height of the lowest Cube.
+        quint8 bottom;
+        //! - Height of the highest Cube.
+        quint8 top;
+    }; // struct Span
+
+    //! Called to get the bit of a face in a visible face mask.
+    static quint8 faceBit( CubeFace cubeFace ) { return (quint8)( 1 << cubeFace ); }
+
+    //! Called to get the visible face mask of a Cube from the heights of its neighbours.
+    static quint8 visibleFaces( quint8 cubeType, int height, int farHeight, int nearHeight, int leftHeight, int rightHeight );
+
 private: // Constructors / Destructors
     //! Cube class constructor.
     Cube();
@@ -78,11 +102,11 @@ private: // Member Functions
     //! Called to load the Cube OpenGL resources.
     static void load();
 
-    //! Called to render the Cube OpenGL resources.
-    void render( const Camera & camera, const Light & light );
+    //! Called to render the Cube OpenGL resources for a cell.
+    static void render( const Camera & camera, const Light & light, const QVector3D & position, CubeType cubeType, quint8 faces );
 
-    //! Called to update the Cube.
-    void tick();
+    //! Called to update the Cubes.
+    static void tick();
 
     //! Called to unload the Cube OpenGL resources.
     static void unload();
@@ -97,8 +121,8 @@ private: // Helper Functions
     //! Called to load the Cube OpenGL textures.
     static bool loadTexture( CubeType cubeType, QString texture );
 
-    //! Called to load the Cube face.
-    void renderFace( CubeFace cubeFace );
+    //! Called to render a Cube face, if it is visible.
+    static void renderFace( CubeFace cubeFace, quint8 faces );
 
 private: // Member Variables
     //! Used to store the bounding Box for the Cube.
@@ -107,23 +131,14 @@ private: // Member Variables
     //! Used to store the OpenGL buffers for the Cube.
     static QGLBuffer mBufferFace[ CUBE_FACE_COUNT ];
 
-    //! Used to store the visible faces of the Cube to render.
-    bool mFace[ CUBE_FACE_COUNT ];
-
     //! Used to track if the shared Cube OpenGL resources are loaded.
     static bool mLoaded;
 
-    //! Used to store the position of the Cube.
-    QVector3D mPosition;
-
     //! Used to store the shader program used to render the Cube.
     static QOpenGLShaderProgram mProgram;
 
     //! Used to store the OpenGL textures for the Cube.
     static QOpenGLTexture *mpTexture[CUBE_TYPE_COUNT];
-
-    //! Used to store the CubeType of the Cube.
-    CubeType mType;
 }; // class Cube
 
 #endif // CUBE_H
@@ -0,0 +1,122 @@
+/*! \file cyclebenchmark.cpp
+\brief CycleBenchmark class implementation file.
+This file contains the CycleBenchmark class implementation for the application.
+*/
+
+// cyclebenchmark.h header file required for CycleBenchmark class definition.
+#include "cyclebenchmark.h"
+
+// QElapsedTimer header file required for timing the cycles.
+#include <QElapsedTimer>
+
+// arena.h header file required for the heap counters.
+#include "arena.h"
+// levelpack.h header file required for the number of Levels.
+#include "levelpack.h"
+// settings.h header file required for the tick interval.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The CycleBenchmark execution begins here.
+//! Create a CycleBenchmark with its own World.
+CycleBenchmark::CycleBenchmark() :
+    mWorld( ENGINE_TICK_INTERVAL ),
+    mOut( stdout )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "CycleBenchmark::CycleBenchmark()...";
+} // CycleBenchmark::CycleBenchmark()
+
+//! The CycleBenchmark execution ends here.
+//! Destroy the CycleBenchmark.
+CycleBenchmark::~CycleBenchmark()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "CycleBenchmark::~CycleBenchmark()...";
+} // CycleBenchmark::~CycleBenchmark()
+
+//! Load and unload the Levels in turn, reporting the time of each phase and the heap blocks taken.
+//! \param cycles is the number of Level loads and unloads.
+//! \return int is the process exit status, zero when every Level loaded.
+int CycleBenchmark::run( uint cycles )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "CycleBenchmark::run()...";
+
+    uint levelCount = LevelPack::instance().count();
+
+    if( cycles == 0 || levelCount == 0 )
+    {
+        mOut << "No cycles to run" << endl;
+        return 1;
+    } // if( cycles == 0 || levelCount == 0 )
+
+    Level & level = mWorld.level();
+
+    QElapsedTimer timer;
+    qint64 loadTime = 0;
+    qint64 loadMax = 0;
+    qint64 unloadTime = 0;
+    qint64 unloadMax = 0;
+    qint64 peakUsed = 0;
+    qint64 peakReserved = 0;
+
+    //! The first pass over the Levels fills the pool, the heap blocks taken after it are churn.
+    uint warmup = qMin( cycles, levelCount );
+    qint64 startBlocks = Arena::heapBlocks();
+    qint64 warmBlocks = startBlocks;
+
+    for( uint cycle = 0; cycle < cycles; cycle++ )
+    {
+        if( cycle == warmup )
+        {
+            warmBlocks = Arena::heapBlocks();
+        } // if( cycle == warmup )
+
+        level.levelIndex() = 1 + cycle % levelCount;
+
+        timer.start();
+        bool loaded = level.loadData();
+        qint64 elapsed = timer.nsecsElapsed();
+
+        if( loaded == false )
+        {
+            mOut << "Level " << level.levelIndex() << ": unable to load level, " << level.loadError() << endl;
+            return 1;
+        } // if( loaded == false )
+
+        loadTime += elapsed;
+        loadMax   = qMax( loadMax, elapsed );
+
+        //! The Level Arena is measured before it is reset by the unload.
+        peakUsed     = qMax( peakUsed, level.arena()->used() );
+        peakReserved = qMax( peakReserved, level.arena()->reserved() );
+
+        timer.restart();
+        level.unload();
+        elapsed = timer.nsecsElapsed();
+
+        unloadTime += elapsed;
+        unloadMax   = qMax( unloadMax, elapsed );
+    } // for( uint cycle = 0; cycle < cycles; cycle++ )
+
+    qint64 endBlocks = Arena::heapBlocks();
+    if( cycles == warmup )
+    {
+        warmBlocks = endBlocks;
+    } // if( cycles == warmup )
+
+    mOut << cycles << " cycles over " << levelCount << " levels" << endl;
+    mOut << "Load:   " << QString::number( loadTime / 1000.0 / cycles, 'f', 1 ) << " uS mean, "
+         << QString::number( loadMax / 1000.0, 'f', 1 ) << " uS max" << endl;
+    mOut << "Unload: " << QString::number( unloadTime / 1000.0 / cycles, 'f', 2 ) << " uS mean, "
+         << QString::number( unloadMax / 1000.0, 'f', 2 ) << " uS max" << endl;
+    mOut << "Heap:   " << warmBlocks - startBlocks << " arena blocks in the first " << warmup << " cycles, "
+         << endBlocks - warmBlocks << " in the other " << cycles - warmup << endl;
+    mOut << "Slack:  largest level used " << peakUsed << " of " << peakReserved << " arena bytes" << endl;
+
+    Arena::report( mOut );
+
+    return 0;
+} // CycleBenchmark::run( uint cycles )
@@ -0,0 +1,44 @@
+/*! \file cyclebenchmark.h
+\brief CycleBenchmark class declaration file.
+This file contains the CycleBenchmark class declaration for the application.
+*/
+
+#ifndef CYCLEBENCHMARK_H
+#define CYCLEBENCHMARK_H
+
+// QTextStream header file required for reporting.
+#include <QTextStream>
+
+// world.h header file required for World access.
+#include "world.h"
+
+//! CycleBenchmark class.
+/*!
+This class declaration encapsulates the Level load and unload CycleBenchmark functionality.
+The Levels are loaded and unloaded in turn, without any OpenGL resource, and the time of
+each load and unload is reported with the heap blocks the Level Arenas took, during the
+first pass over the Levels and once every Arena is back in the pool, so a Level cycle that
+churns or fragments the heap shows.
+*/
+class CycleBenchmark
+{
+public: // Constructors / Destructors
+    //! CycleBenchmark class constructor.
+    CycleBenchmark();
+
+    //! CycleBenchmark class destructor.
+    ~CycleBenchmark();
+
+public: // Member Functions
+    //! Called to run the CycleBenchmark over a number of Level cycles.
+    int run( uint cycles );
+
+private: // Member Variables
+    //! Used to store the World the Levels are loaded into.
+    World mWorld;
+
+    //! Used to write the report.
+    QTextStream mOut;
+}; // class CycleBenchmark
+
+#endif // CYCLEBENCHMARK_H
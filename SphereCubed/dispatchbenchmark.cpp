@@ -0,0 +1,262 @@
+/*! \file dispatchbenchmark.cpp
+\brief DispatchBenchmark class implementation file.
+This file contains the DispatchBenchmark class implementation for the application.
+*/
+
+// dispatchbenchmark.h header file required for DispatchBenchmark class definition.
+#include "dispatchbenchmark.h"
+
+// QElapsedTimer header file required for timing the dispatch.
+#include <QElapsedTimer>
+
+// machine.h header file required for the virtual Machine.
+#include "machine.h"
+// staticmachine.h header file required for the StaticMachine.
+#include "staticmachine.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Number of ticks between Trigger passes, so both machines change State now and then.
+#define DISPATCH_TRIGGER_PERIOD 1024
+
+
+//------------------------------------------------------------------------------
+// Shared Context
+
+
+//! Internal context the benchmark States and Triggers work on.
+struct DispatchContext
+{
+    //! - Number of State ticks.
+    uint ticks;
+    //! - Number of State enters.
+    uint enters;
+    //! - Bus the StaticMachine takes its topics from.
+    Bus events;
+
+    //! Called by the StaticMachine to get the Bus.
+    Bus & bus() { return events; }
+}; // struct DispatchContext
+
+//! Internal test shared by every benchmark Trigger.
+static inline bool dispatchTriggered( uint ticks )
+{
+    return ( ticks % DISPATCH_TRIGGER_PERIOD ) == 0;
+}
+
+
+//------------------------------------------------------------------------------
+// Virtual Machine
+
+
+//! Internal virtual benchmark State.
+class VirtualDispatchState : public State
+{
+    //! Friend of VirtualDispatchMachine so that it can configure the State.
+    friend class VirtualDispatchMachine;
+
+public:
+    //! VirtualDispatchState class constructor.
+    VirtualDispatchState( DispatchContext & context ) : State( "VirtualDispatchState" ), mContext( context ) {}
+
+private:
+    //! Triggered when entering.
+    virtual void enter() { mContext.enters++; }
+
+    //! Triggered periodically.
+    virtual void tick() { mContext.ticks++; }
+
+    //! Used to reference the context.
+    DispatchContext & mContext;
+}; // class VirtualDispatchState
+
+//! Internal virtual benchmark Event.
+class VirtualDispatchEvent : public Event
+{
+    //! Friend of VirtualDispatchMachine so that it can configure the Event.
+    friend class VirtualDispatchMachine;
+
+public:
+    //! VirtualDispatchEvent class constructor.
+    VirtualDispatchEvent( DispatchContext & context ) : Event( "VirtualDispatchEvent" ), mContext( context ) {}
+
+private:
+    //! Test Event condition triggered.
+    virtual State * test() { return dispatchTriggered( mContext.ticks ) ? mpState : NULL; }
+
+    //! Used to reference the context.
+    DispatchContext & mContext;
+}; // class VirtualDispatchEvent
+
+//! Internal virtual benchmark Machine, configured the same as the Game.
+class VirtualDispatchMachine : public Machine
+{
+public:
+    //! VirtualDispatchMachine class constructor.
+    VirtualDispatchMachine( DispatchContext & context ) : Machine( "VirtualDispatchMachine" )
+    {
+        //! Create the menu, died, finished, over, play, and won States.
+        VirtualDispatchState * pState[6];
+        for( int i = 0; i < 6; i++ )
+        {
+            pState[i] = new VirtualDispatchState( context );
+            addState( pState[i] );
+        }
+
+        //! Create the Transitions in the same order as the Game.
+        static const int TRANSITIONS[9][2] =
+        {
+            { 1, 3 }, { 1, 4 }, { 2, 5 }, { 2, 4 }, { 0, 4 }, { 3, 0 }, { 4, 1 }, { 4, 2 }, { 5, 0 }
+        };
+
+        for( int i = 0; i < 9; i++ )
+        {
+            VirtualDispatchEvent * pEvent = new VirtualDispatchEvent( context );
+            pEvent->setTransitionState( pState[ TRANSITIONS[i][1] ] );
+            pState[ TRANSITIONS[i][0] ]->addEvent( pEvent );
+            addEvent( pEvent );
+        }
+
+        setStartState( pState[0] );
+    }
+}; // class VirtualDispatchMachine
+
+
+//------------------------------------------------------------------------------
+// Static Machine
+
+
+//! Internal static benchmark State, the tag makes each State a distinct type.
+template< int Tag >
+class StaticDispatchState
+{
+    //! Friend of StaticMachine so that it can instantiate the State.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
+
+private:
+    //! StaticDispatchState class constructor.
+    StaticDispatchState( DispatchContext & context ) : mContext( context ) {}
+
+    //! Triggered when entering.
+    void enter() { mContext.enters++; }
+
+    //! Triggered when exiting.
+    void exit() {}
+
+    //! Triggered when rendering.
+    void render() {}
+
+    //! Triggered periodically, publishes a request when the Trigger is due to pass.
+    void tick() { if( dispatchTriggered( ++mContext.ticks ) ) { mContext.events.publish( Bus::TOPIC_REQUEST ); } }
+
+    //! Used to reference the context.
+    DispatchContext & mContext;
+}; // class StaticDispatchState
+
+//! Internal static benchmark Trigger.
+class StaticDispatchTrigger
+{
+    //! Friend of StaticMachine so that it can instantiate the Trigger.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
+
+private:
+    //! StaticDispatchTrigger class constructor.
+    StaticDispatchTrigger( DispatchContext & context ) : mContext( context ) {}
+
+    //! Test Trigger condition.
+    bool test() { return dispatchTriggered( mContext.ticks ); }
+
+    //! The Bus topics that can change the test result.
+    static const unsigned int TOPICS = Bus::TOPIC_REQUEST | Bus::TOPIC_STATE_ENTERED;
+
+    //! Used to reference the context.
+    DispatchContext & mContext;
+}; // class StaticDispatchTrigger
+
+//! Internal static benchmark Machine, configured the same as the Game.
+typedef StaticMachine< DispatchContext,
+    TypeList< StaticDispatchState<0>, StaticDispatchState<1>, StaticDispatchState<2>,
+              StaticDispatchState<3>, StaticDispatchState<4>, StaticDispatchState<5> >,
+    TypeList< Transition< StaticDispatchState<1>, StaticDispatchTrigger, StaticDispatchState<3> >,
+              Transition< StaticDispatchState<1>, StaticDispatchTrigger, StaticDispatchState<4> >,
+              Transition< StaticDispatchState<2>, StaticDispatchTrigger, StaticDispatchState<5> >,
+              Transition< StaticDispatchState<2>, StaticDispatchTrigger, StaticDispatchState<4> >,
+              Transition< StaticDispatchState<0>, StaticDispatchTrigger, StaticDispatchState<4> >,
+              Transition< StaticDispatchState<3>, StaticDispatchTrigger, StaticDispatchState<0> >,
+              Transition< StaticDispatchState<4>, StaticDispatchTrigger, StaticDispatchState<1> >,
+              Transition< StaticDispatchState<4>, StaticDispatchTrigger, StaticDispatchState<2> >,
+              Transition< StaticDispatchState<5>, StaticDispatchTrigger, StaticDispatchState<0> > > > StaticDispatchMachine;
+
+
+//------------------------------------------------------------------------------
+// DispatchBenchmark
+
+
+//! The DispatchBenchmark execution begins here.
+DispatchBenchmark::DispatchBenchmark() :
+    mOut( stdout )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "DispatchBenchmark::DispatchBenchmark()...";
+} // DispatchBenchmark::DispatchBenchmark()
+
+//! The DispatchBenchmark execution ends here.
+DispatchBenchmark::~DispatchBenchmark()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "DispatchBenchmark::~DispatchBenchmark()...";
+} // DispatchBenchmark::~DispatchBenchmark()
+
+//! Run the DispatchBenchmark.
+//! \param ticks is the number of ticks to run each machine for.
+//! \return int is the process exit status, zero on success.
+int DispatchBenchmark::run( uint ticks )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "DispatchBenchmark::run()...";
+
+    if( ticks == 0 )
+    {
+        mOut << "No ticks to run" << endl;
+        return 1;
+    }
+
+    QElapsedTimer timer;
+
+    //! Time the virtual Machine.
+    DispatchContext virtualContext = { 1, 0 };
+    VirtualDispatchMachine virtualMachine( virtualContext );
+    virtualMachine.start();
+
+    timer.start();
+    for( uint i = 0; i < ticks; i++ )
+    {
+        virtualMachine.tick();
+    }
+    qint64 virtualTime = timer.nsecsElapsed();
+
+    //! Time the StaticMachine.
+    DispatchContext staticContext = { 1, 0 };
+    StaticDispatchMachine staticMachine( staticContext );
+    staticMachine.start();
+
+    timer.start();
+    for( uint i = 0; i < ticks; i++ )
+    {
+        staticMachine.tick();
+    }
+    qint64 staticTime = timer.nsecsElapsed();
+
+    //! Both machines must have followed the same path.
+    if( virtualContext.ticks != staticContext.ticks || virtualContext.enters != staticContext.enters )
+    {
+        mOut << "Machines diverged" << endl;
+        return 1;
+    }
+
+    mOut << ticks << " ticks, " << staticContext.enters << " transitions" << endl;
+    mOut << "Machine:       " << QString::number( (double)virtualTime / ticks, 'f', 2 ) << " nS per tick" << endl;
+    mOut << "StaticMachine: " << QString::number( (double)staticTime / ticks, 'f', 2 ) << " nS per tick" << endl;
+
+    return 0;
+} // DispatchBenchmark::run( uint ticks )
@@ -0,0 +1,37 @@
+/*! \file dispatchbenchmark.h
+\brief DispatchBenchmark class declaration file.
+This file contains the DispatchBenchmark class declaration for the application.
+*/
+
+#ifndef DISPATCHBENCHMARK_H
+#define DISPATCHBENCHMARK_H
+
+// QTextStream header file required for reporting.
+#include <QTextStream>
+
+//! DispatchBenchmark class.
+/*!
+This class declaration encapsulates the State Machine DispatchBenchmark functionality.
+The same six State, nine Transition machine as the Game is built once on the virtual
+Machine, State and Event classes and once on the StaticMachine, with trivial States and
+Triggers, and the per tick dispatch cost of each is reported.
+*/
+class DispatchBenchmark
+{
+public: // Constructors / Destructors
+    //! DispatchBenchmark class constructor.
+    DispatchBenchmark();
+
+    //! DispatchBenchmark class destructor.
+    ~DispatchBenchmark();
+
+public: // Member Functions
+    //! Called to run the DispatchBenchmark.
+    int run( uint ticks );
+
+private: // Member Variables
+    //! Used to write the report.
+    QTextStream mOut;
+}; // class DispatchBenchmark
+
+#endif // DISPATCHBENCHMARK_H
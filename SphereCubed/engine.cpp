@@ -8,11 +8,23 @@ This file contains the Engine class implementation for the application.
 
 // QApplication header file required for sending events.
 #include <QApplication>
+// QElapsedTimer header file required for timing the Level reloads.
+#include <QElapsedTimer>
 // QEvent header file required for processing events.
 #include <QEvent>
+// QFile header file required for finding a replaced Level file.
+#include <QFile>
+// QKeyEvent header file required for the memory report key.
+#include <QKeyEvent>
+// QTextStream header file required for reporting the statistics.
+#include <QTextStream>
 // <gl.h> header file required for OpenGL commands.
 #include <GL/gl.h>
 
+// jobs.h header file required for the Jobs system statistics.
+#include "jobs.h"
+// memory.h header file required for the memory report.
+#include "memory.h"
 // settings.h header file required for application settings.
 #include "settings.h"
 // trace.h header file required for tracing execution.
@@ -25,14 +37,35 @@ This file contains the Engine class implementation for the application.
 //! Automatically called by the Window during construction.
 //! Passes parent argument onto base class constructor.
 //! \param timeInterval is the tick timer cycle interval.
+//! \param options is a reference to the run time options.
 //! \param parent is a pointer the QWidget parent object.
-Engine::Engine( int timeInterval, QObject * parent ) :
+Engine::Engine( int timeInterval, const Options & options, QObject * parent ) :
     QObject( parent ),
-    mTimeInterval( timeInterval ),
+    mPacer( timeInterval ),
     mWorld( timeInterval ),
     mGame( mWorld )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Engine::Engine( QObject * parent )...";
+
+    //! Enable the Latency measurement when requested.
+    mWorld.latency().enabled() = options.latency;
+
+    //! Report the Pacer, Physics and Jobs system statistics on exit when requested.
+    mStats = options.stats;
+
+    //! Tick whenever the Pacer reaches tick deadlines.
+    connect( &mPacer, &Pacer::tick, this, &Engine::tick );
+
+    //! Reload the Level on the next tick whenever its Level file changes.
+    connect( &mWatcher, &QFileSystemWatcher::fileChanged, this, [ this ]() { mReloadPending = true; } );
+
+    //! When requested, run the Physics on its own Simulation thread.
+    if( options.threaded == true )
+    {
+        mpSimulation = new Simulation( timeInterval );
+        mWorld.mpSimulation = mpSimulation;
+        mWorld.mLevel.mpSimulation = mpSimulation;
+    } // if( options.threaded == true )
 } // Engine::Engine( QObject * parent )
 
 //! The Engine execution ends here.
@@ -41,6 +74,31 @@ Engine::Engine( int timeInterval, QObject * parent ) :
 Engine::~Engine()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Engine::~Engine()...";
+
+    //! Stop the Simulation thread, if any, so its Physics can be reported.
+    if( mpSimulation != NULL )
+    {
+        mpSimulation->stop();
+    } // if( mpSimulation != NULL )
+
+    //! Report the Pacer, Physics, Level chunk, Jobs system and memory statistics, if enabled.
+    if( mStats == true )
+    {
+        QTextStream out( stdout );
+        mPacer.report( out );
+        ( ( mpSimulation != NULL ) ? mpSimulation->mWorld : mWorld ).physics().report( out );
+        ( ( mpSimulation != NULL ) ? mpSimulation->mWorld : mWorld ).level().report( out );
+        Jobs::instance().report( out );
+        Memory::report( out );
+    } // if( mStats == true )
+
+    //! Free the Simulation thread, if any.
+    mWorld.mpSimulation = NULL;
+    mWorld.mLevel.mpSimulation = NULL;
+    delete mpSimulation;
+
+    //! Report the Latency measurement, if enabled.
+    mWorld.latency().report();
 } // Engine::~Engine()
 
 //! Process received events.
@@ -57,11 +115,30 @@ bool Engine::event( QEvent * event )
     //! Determine what type of event was received.
     switch( event->type() )
     {
-    //! When it is a Timer event type.
-    case QEvent::Timer:
-        //! Tick the Engine to update and render the scene.
-        tick();
+    //! When it is a KeyPress event type.
+    case QEvent::KeyPress:
+    {
+        //! Time stamp the key press as it arrives.
+        qint64 arrived = mWorld.latency().now();
+
+        //! The memory report key is a debug key, the Game never sees it.
+        if( static_cast< QKeyEvent * >( event )->key() == ENGINE_MEMORY_REPORT_KEY )
+        {
+            QTextStream out( stdout );
+            Memory::report( out );
+            break;
+        } // if( static_cast< QKeyEvent * >( event )->key() == ENGINE_MEMORY_REPORT_KEY )
+
+        //! Send event to the Game Machine.
+        rVal = QApplication::sendEvent( &mGame, event );
+
+        //! If the key press was accepted, follow it through to the display.
+        if( rVal == true )
+        {
+            mWorld.latency().inputAccepted( arrived );
+        } // if( rVal == true )
         break;
+    }
 
     //! When it is any other event.
     default:
@@ -80,11 +157,17 @@ void Engine::initialize()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Engine::initialize()...";
 
+    //! Start the Simulation thread, if any, it stays paused until the Game plays a Level.
+    if( mpSimulation != NULL )
+    {
+        mpSimulation->start();
+    } // if( mpSimulation != NULL )
+
     //! Start the Game Machine.
     mGame.start();
 
-    //! Start the timer to periodically update the Game Machine.
-    startTimer( mTimeInterval );
+    //! Start the Pacer to periodically update the Game Machine.
+    mPacer.start();
 } // Engine::initialize()
 
 //! Render the scene.
@@ -114,16 +197,99 @@ void Engine::resize( const int width, const int height )
     mWorld.camera().resize( width, height );
 } // Engine::resize( const int width, const int height )
 
+//! A rendered frame has been swapped to the display.
+//! \return void
+//! \sa Latency, Window
+void Engine::swapped()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Engine::swapped()...";
+
+    //! Time stamp the displayed frame.
+    mWorld.latency().frameSwapped();
+} // Engine::swapped()
+
 //! Update the scene.
+//! When the Pacer is catching up on missed deadlines the Game Machine is updated once per
+//! tick due, but the scene is only rendered once.
+//! \param count is the number of ticks due.
 //! \return void
-//! \sa Engine
-void Engine::tick()
+//! \sa Engine, Pacer
+void Engine::tick( uint count )
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "Engine::tick()...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "Engine::tick()..." << count;
+
+    //! Apply the changes of the Level file, before the ticks so they see the new Cubes.
+    watch();
+
+    //! Update the Game Machine once per tick due. Each tick samples the Player Input up to
+    //! its own deadline, one interval apart, so the ticks catching up cover an interval each.
+    qint64 now = Input::now();
 
-    //! Update the Game Machine.
-    mGame.tick();
+    for( uint i = 0; i < count; i++ )
+    {
+        mWorld.tickTime() = now - ( count - 1 - i ) * mPacer.mInterval;
+        mGame.tick();
+    } // for( uint i = 0; i < count; i++ )
 
     //! Signal that the engine has updated the scene and is ready to render the scene.
     emit updateUI();
 } // Engine::tick()
+
+//! Watch the Level file being played, and when it changed since the last tick reload the
+//! Level, in the Simulation too, keeping the Player state. Only the changed cells are
+//! rebuilt, so the edits show on the next frame.
+//! \return void
+//! \sa Level::reload
+void Engine::watch()
+{
+    const QString & path = mWorld.level().sourceFile();
+
+    //! Follow the Level being played.
+    if( path != mWatched )
+    {
+        if( mWatched.isEmpty() == false )
+        {
+            mWatcher.removePath( mWatched );
+        } // if( mWatched.isEmpty() == false )
+
+        mWatched = path;
+        mReloadPending = false;
+
+        if( path.isEmpty() == false )
+        {
+            mWatcher.addPath( path );
+        } // if( path.isEmpty() == false )
+    } // if( path != mWatched )
+    //! An editor that saves by replacing the file drops it from the watcher, watch and reload the new file.
+    else if( path.isEmpty() == false && mWatcher.files().isEmpty() == true && QFile::exists( path ) == true )
+    {
+        mWatcher.addPath( path );
+        mReloadPending = true;
+    } // if( path != mWatched ) else if( ... )
+
+    if( mReloadPending == false )
+    {
+        return;
+    } // if( mReloadPending == false )
+
+    mReloadPending = false;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    int changed = mWorld.level().reload();
+
+    if( changed < 0 )
+    {
+        QTextStream( stderr ) << mWorld.level().loadError() << endl;
+        return;
+    } // if( changed < 0 )
+
+    if( mpSimulation != NULL )
+    {
+        mpSimulation->reload();
+    } // if( mpSimulation != NULL )
+
+    QTextStream( stdout ) << "Reloaded " << path << ": " << changed << " cells changed in "
+                          << QString::number( timer.nsecsElapsed() / 1000000.0, 'f', 2 ) << " mS" << endl;
+} // Engine::watch()
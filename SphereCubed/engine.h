@@ -6,11 +6,19 @@ This file contains the Engine class declaration for the application.
 #ifndef ENGINE_H
 #define ENGINE_H
 
+// QFileSystemWatcher header file required for reloading the Level file when it changes.
+#include <QFileSystemWatcher>
 // QObject header file required for signals, slots, and events.
 #include <QObject>
 
 // game.h header file required for game Machine.
 #include "game.h"
+// pacer.h header file required for the tick deadlines.
+#include "pacer.h"
+// options.h header file required for run time options.
+#include "options.h"
+// simulation.h header file required for the threaded mode.
+#include "simulation.h"
 // world.h header file required for world functionality.
 #include "world.h"
 
@@ -29,7 +37,7 @@ class Engine : public QObject
 
 private: // Constructors / Destructors
     //! Engine class constructor.
-    explicit Engine( int timeInterval, QObject * parent = 0 );
+    explicit Engine( int timeInterval, const Options & options, QObject * parent = 0 );
 
     //! Engine class destructor.
     ~Engine();
@@ -47,12 +55,19 @@ private: // Member Function
     //! Triggered whenever the OpenGL context needs to be resized.
     void resize( const int width, const int height );
 
-    //! Triggered whenever the Timer expires.
-    void tick();
+    //! Triggered whenever a rendered frame has been swapped to the display.
+    void swapped();
+
+    //! Triggered whenever the Pacer reaches tick deadlines.
+    void tick( uint count );
+
+private: // Helper Functions
+    //! Called to watch the Level file being played and reload the Level when it changes.
+    void watch();
 
 private: // Member Variables
-    //! Used to store the tick timer time interval.
-    int mTimeInterval;
+    //! Used to keep the ticks on their deadlines.
+    Pacer mPacer;
 
     //! Used to encapsulate game data and functionality.
     World mWorld;
@@ -60,6 +75,21 @@ private: // Member Variables
     //! Used for game play state machine logic to control World.
     Game mGame;
 
+    //! Used to run the Physics on its own thread, initialized to NULL for the single threaded mode.
+    Simulation * mpSimulation = NULL;
+
+    //! Used to report the Pacer, Physics and Jobs system statistics on exit, initialized to false.
+    bool mStats = false;
+
+    //! Used to watch the Level file being played.
+    QFileSystemWatcher mWatcher;
+
+    //! Used to store the Level file being watched, empty when the Level cannot change.
+    QString mWatched;
+
+    //! Used to remember the Level file changed since the last tick, initialized to false.
+    bool mReloadPending = false;
+
 signals:
     //! Emitted to begin rendering scene.
     //! \return void
@@ -7,12 +7,18 @@ This file contains the Game class implementation for the application.
 #include "game.h"
 
 
+// QApplication header file required for sending events.
+#include <QApplication>
 // QKeyEvent header file required for processing key events.
 #include <QKeyEvent>
 
 
+// levelpack.h header file required for the number of Levels.
+#include "levelpack.h"
 // setting.h header file required for application seeting.
 #include "settings.h"
+// simulation.h header file required for the threaded mode.
+#include "simulation.h"
 // trace.h header file required for tracing execution.
 #include "trace.h"
 
@@ -28,10 +34,8 @@ This file contains the Game class implementation for the application.
 
 //! The GameDiedState execution begins here.
 //! Create a GameDiedState and pass it a reference to the World data.
-//! Passes a name for the state as a QString to the base class.
 //! \param world is a reference to the World data.
 GameDiedState::GameDiedState( World & world ) :
-    State( "GameDiedState" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameDiedState( World & world )...";
@@ -57,6 +61,9 @@ void GameDiedState::enter()
 
     //! Load the Menu with the died background image.
     mWorld.menu().load(":ImageMenuDied");
+
+    //! Start preparing the Level again, so pressing Space restarts it instantly.
+    mWorld.level().prefetch( mWorld.level().levelIndex(), mWorld.level().levelFile() );
 } // GameDiedState::enter()
 
 //! Process received events.
@@ -145,10 +152,8 @@ void GameDiedState::tick()
 
 //! The GameFinishedState execution begins here.
 //! Create a GameFinishedState and pass it a reference to the World data.
-//! Passes a name for the state as a QString to the base class.
 //! \param world is a reference to the World data.
 GameFinishedState::GameFinishedState( World & world ) :
-    State( "GameFinishedState" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameFinishedState( World & world )...";
@@ -174,6 +179,12 @@ void GameFinishedState::enter()
 
     //! Load the Menu with the finished background image.
     mWorld.menu().load(":ImageMenuFinished");
+
+    //! If there is a next Level, start preparing it, so pressing Space starts it instantly.
+    if( mWorld.level().levelIndex() < LevelPack::instance().count() )
+    {
+        mWorld.level().prefetch( mWorld.level().levelIndex() + 1, mWorld.level().levelFile() );
+    } // if( mWorld.level().levelIndex() < LevelPack::instance().count() )
 } // GameFinishedState::enter()
 
 //! Process received events.
@@ -265,10 +276,8 @@ void GameFinishedState::tick()
 
 //! The GameMenuState execution begins here.
 //! Create a GameMenuState and pass it a reference to the World data.
-//! Passes a name for the state as a QString to the base class.
 //! \param world is a reference to the World data.
 GameMenuState::GameMenuState( World & world ) :
-    State( "GameMenuState" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameMenuState( World & world )...";
@@ -300,6 +309,9 @@ void GameMenuState::enter()
 
     //! Load the Menu with the menu background image.
     mWorld.menu().load(":ImageMenuMenu");
+
+    //! Start preparing the first Level, so pressing Space starts it instantly.
+    mWorld.level().prefetch( mWorld.level().levelIndex(), mWorld.level().levelFile() );
 } // GameMenuState::enter()
 
 //! Process received events.
@@ -388,10 +400,8 @@ void GameMenuState::tick()
 
 //! The GameOverState execution begins here.
 //! Create a GameOverState and pass it a reference to the World data.
-//! Passes a name for the state as a QString to the base class.
 //! \param world is a reference to the World data.
 GameOverState::GameOverState( World & world ) :
-    State( "GameOverState" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameOverState( World & world )...";
@@ -505,10 +515,8 @@ void GameOverState::tick()
 
 //! The GamePlayState execution begins here.
 //! Create a GamePlayState and pass it a reference to the World data.
-//! Passes a name for the state as a QString to the base class.
 //! \param world is a reference to the World data.
 GamePlayState::GamePlayState( World & world ) :
-    State( "GamePlayState" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GamePlayState( World & world )...";
@@ -532,7 +540,7 @@ void GamePlayState::enter()
     //! Set the Camera Play flag to trigger the Play Event to Switch to the Play State.
     mWorld.camera().setPlay( true );
 
-    //! Load the Level.
+    //! Load the Level, the Level data was prefetched while in the menu so only the OpenGL upload is left.
     mWorld.level().load();
 
     //! Load the Player.
@@ -540,6 +548,12 @@ void GamePlayState::enter()
 
     //! Position the Player at the Level start position.
     mWorld.player().position() = mWorld.level().startPosition();
+
+    //! If the Physics runs on the Simulation thread, start it simulating the Level.
+    if( mWorld.simulation() != NULL )
+    {
+        mWorld.simulation()->play( mWorld.level().levelIndex(), mWorld.level().levelFile() );
+    } // if( mWorld.simulation() != NULL )
 } // GamePlayState::enter()
 
 //! Process received events.
@@ -559,7 +573,16 @@ bool GamePlayState::event( QEvent * event )
     //! When it is any other event. Do nothing.
     default:
         TraceOut( TRACE_FILE_EXECUTION ) << "Event " << event->type() << " NOT processed in GamePlayState...";
-        rVal = QApplication::sendEvent( &mWorld.player(), event );
+
+        //! Send it to the Player, or queue it for the Simulation thread.
+        if( mWorld.simulation() != NULL )
+        {
+            rVal = mWorld.simulation()->post( event );
+        }
+        else
+        {
+            rVal = QApplication::sendEvent( &mWorld.player(), event );
+        }
         break;
     } // switch( event->type() )
 
@@ -574,6 +597,12 @@ void GamePlayState::exit()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GamePlayState::exit...";
 
+    //! If the Physics runs on the Simulation thread, stop it simulating the Level.
+    if( mWorld.simulation() != NULL )
+    {
+        mWorld.simulation()->pause();
+    } // if( mWorld.simulation() != NULL )
+
     //! Unload the Level.
     mWorld.level().unload();
 
@@ -605,8 +634,16 @@ void GamePlayState::tick()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GamePlayState::tick...";
 
-    //! Update the physics.
-    mWorld.physics().tick();
+    //! If the Physics runs on the Simulation thread, take its newest Player state.
+    if( mWorld.simulation() != NULL )
+    {
+        mWorld.simulation()->synchronize( mWorld );
+    } // if( mWorld.simulation() != NULL )
+    //! Else update the physics.
+    else
+    {
+        mWorld.physics().tick( mWorld.tickTime() );
+    } // if( mWorld.simulation() != NULL ) else
 
     //! Update the Player.
     mWorld.player().tick();
@@ -627,10 +664,8 @@ void GamePlayState::tick()
 
 //! The GameWonState execution begins here.
 //! Create a GameWonState and pass it a reference to the World data.
-//! Passes a name for the state as a QString to the base class.
 //! \param world is a reference to the World data.
 GameWonState::GameWonState( World & world ) :
-    State( "GameWonState" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameWonState( World & world )...";
@@ -750,10 +785,8 @@ void GameWonState::tick()
 
 //! The GameDiedEvent execution begins here.
 //! Create a GameDiedEvent and pass it a reference to the World data.
-//! Passes a name for the event as a QString to the base class.
 //! \param world is a reference to the World data.
 GameDiedEvent::GameDiedEvent( World & world ) :
-    Event( "GameDiedEvent" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameDiedEvent( World & world )...";
@@ -767,13 +800,12 @@ GameDiedEvent::~GameDiedEvent()
     TraceOut( TRACE_FILE_EXECUTION ) << "~GameDiedEvent()...";
 } // GameDiedEvent::~GameDiedEvent()
 
-//! Called periodically to check if Event occured.
-//! Class derived from Event must implement to test for event.
-//! \return State * is a pointer to the state to transition to.
-//! \sa Event, State, Machine
-State * GameDiedEvent::test()
+//! Called by the StaticMachine to test the Trigger while a Bus topic of its TOPICS is pending.
+//! \return bool is true when the condition occurred, to transition.
+//! \sa StaticMachine, Bus
+bool GameDiedEvent::test()
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "GameDiedEvent::process...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "GameDiedEvent::test()...";
 
     //! If the Player is not longer in the Level.
     if( mWorld.level().insideLevel( mWorld.player().position() ) == false )
@@ -783,22 +815,20 @@ State * GameDiedEvent::test()
         //! Then they have died, so decrement there number of lives by one.
         mWorld.player().lives()--;
 
-        //! Return the State to transition to.
-        return mpState;
+        //! Return true to transition.
+        return true;
     }
 
-    //! Else don't return a State
-    return NULL;
+    //! Else don't transition.
+    return false;
 } // GameDiedEvent::test()
 
 // GameFinishedEvent---------------------------------------------------------------
 
 //! The GameFinishedEvent execution begins here.
 //! Create a GameFinishedEvent and pass it a reference to the World data.
-//! Passes a name for the event as a QString to the base class.
 //! \param world is a reference to the World data.
 GameFinishedEvent::GameFinishedEvent( World & world ) :
-    Event( "GameFinishedEvent" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameFinishedEvent( World & world )...";
@@ -812,38 +842,35 @@ GameFinishedEvent::~GameFinishedEvent()
     TraceOut( TRACE_FILE_EXECUTION ) << "~GameFinishedEvent()...";
 } // GameFinishedEvent::~GameFinishedEvent()
 
-//! Called periodically to check if Event occured.
-//! Class derived from Event must implement to test for event.
-//! \return State * is a pointer to the state to transition to.
-//! \sa Event, State, Machine
-State * GameFinishedEvent::test()
+//! Called by the StaticMachine to test the Trigger while a Bus topic of its TOPICS is pending.
+//! \return bool is true when the condition occurred, to transition.
+//! \sa StaticMachine, Bus
+bool GameFinishedEvent::test()
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "GameFinishedEvent::process...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "GameFinishedEvent::test()...";
 
-    //! If the Player is positioned on the Finish Cube.
+    //! If the Player is positioned on the Finish Cube, not on a Span above it.
     QVector3D position = mWorld.player().position();
-    if( mWorld.level().cubeType( qRound(position.x()), qRound(position.z()) ) == Cube::CubeType::FINISH )
+    if( mWorld.level().cubeTypeAt( qRound(position.x()), qRound(position.y()) - 1, qRound(position.z()) ) == Cube::CubeType::FINISH )
     {
         TraceOut( TRACE_FILE_EXECUTION ) << "Event occured...";
 
         //! The Level has been completed.
 
-        //! Return the State to transition to.
-        return mpState;
+        //! Return true to transition.
+        return true;
     }
 
-    //! Else don't return a State
-    return NULL;
+    //! Else don't transition.
+    return false;
 } // GameFinishedEvent::test()
 
 // GameLastLevelEvent---------------------------------------------------------------
 
 //! The GameLastLevelEvent execution begins here.
 //! Create a GameLastLevelEvent and pass it a reference to the World data.
-//! Passes a name for the event as a QString to the base class.
 //! \param world is a reference to the World data.
 GameLastLevelEvent::GameLastLevelEvent( World & world ) :
-    Event( "GameLastLevelEvent" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameLastLevelEvent( World & world )...";
@@ -857,37 +884,34 @@ GameLastLevelEvent::~GameLastLevelEvent()
     TraceOut( TRACE_FILE_EXECUTION ) << "~GameLastLevelEvent()...";
 } // GameLastLevelEvent::~GameLastLevelEvent()
 
-//! Called periodically to check if Event occured.
-//! Class derived from Event must implement to test for event.
-//! \return State * is a pointer to the state to transition to.
-//! \sa Event, State, Machine
-State * GameLastLevelEvent::test()
+//! Called by the StaticMachine to test the Trigger while a Bus topic of its TOPICS is pending.
+//! \return bool is true when the condition occurred, to transition.
+//! \sa StaticMachine, Bus
+bool GameLastLevelEvent::test()
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "GameLastLevelEvent::process...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "GameLastLevelEvent::test()...";
 
     //! If the Player was in the last Level.
-    if( mWorld.level().levelIndex() == GAME_LEVEL_COUNT )
+    if( mWorld.level().levelIndex() == LevelPack::instance().count() )
     {
         TraceOut( TRACE_FILE_EXECUTION ) << "Event occured...";
 
         //! The Game has been won.
 
-        //! Return the State to transition to.
-        return mpState;
+        //! Return true to transition.
+        return true;
     }
 
-    //! Else don't return a State
-    return NULL;
+    //! Else don't transition.
+    return false;
 } // GameLastLevelEvent::test()
 
 // GameLastLifeEvent---------------------------------------------------------------
 
 //! The GameLastLifeEvent execution begins here.
 //! Create a GameLastLifeEvent and pass it a reference to the World data.
-//! Passes a name for the event as a QString to the base class.
 //! \param world is a reference to the World data.
 GameLastLifeEvent::GameLastLifeEvent( World & world ) :
-    Event( "GameLastLifeEvent" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameLastLifeEvent( World & world )...";
@@ -901,13 +925,12 @@ GameLastLifeEvent::~GameLastLifeEvent()
     TraceOut( TRACE_FILE_EXECUTION ) << "~GameLastLifeEvent()...";
 } // GameLastLifeEvent::~GameLastLifeEvent()
 
-//! Called periodically to check if Event occured.
-//! Class derived from Event must implement to test for event.
-//! \return State * is a pointer to the state to transition to.
-//! \sa Event, State, Machine
-State * GameLastLifeEvent::test()
+//! Called by the StaticMachine to test the Trigger while a Bus topic of its TOPICS is pending.
+//! \return bool is true when the condition occurred, to transition.
+//! \sa StaticMachine, Bus
+bool GameLastLifeEvent::test()
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "GameLastLifeEvent::process...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "GameLastLifeEvent::test()...";
 
     //! If the Player now has Zero lives.
     if( mWorld.player().lives() == 0 )
@@ -916,22 +939,20 @@ State * GameLastLifeEvent::test()
 
         //! The Game is Over.
 
-        //! Return the State to transition to.
-        return mpState;
+        //! Return true to transition.
+        return true;
     }
 
-    //! Else don't return a State
-    return NULL;
+    //! Else don't transition.
+    return false;
 } // GameLastLifeEvent::test()
 
 // GameReturnEvent---------------------------------------------------------------
 
 //! The GameReturnEvent execution begins here.
 //! Create a GameReturnEvent and pass it a reference to the World data.
-//! Passes a name for the event as a QString to the base class.
 //! \param world is a reference to the World data.
 GameReturnEvent::GameReturnEvent( World & world ) :
-    Event( "GameReturnEvent" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameReturnEvent( World & world )...";
@@ -945,13 +966,12 @@ GameReturnEvent::~GameReturnEvent()
     TraceOut( TRACE_FILE_EXECUTION ) << "~GameReturnEvent()...";
 } // GameReturnEvent::~GameReturnEvent()
 
-//! Called periodically to check if Event occured.
-//! Class derived from Event must implement to test for event.
-//! \return State * is a pointer to the state to transition to.
-//! \sa Event, State, Machine
-State * GameReturnEvent::test()
+//! Called by the StaticMachine to test the Trigger while a Bus topic of its TOPICS is pending.
+//! \return bool is true when the condition occurred, to transition.
+//! \sa StaticMachine, Bus
+bool GameReturnEvent::test()
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "GameReturnEvent::process...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "GameReturnEvent::test()...";
 
     //! If Return equals true
     if( mWorld.getReturn() == true )
@@ -959,22 +979,20 @@ State * GameReturnEvent::test()
         TraceOut( TRACE_FILE_EXECUTION ) << "Event occured...";
         //! The Event has been triggered so reset the condition.
         mWorld.setReturn( false );
-        //! Return the State to transition to.
-        return mpState;
+        //! Return true to transition.
+        return true;
     }
 
-    //! Else don't return a State
-    return NULL;
+    //! Else don't transition.
+    return false;
 } // GameReturnEvent::test()
 
 // GameSpaceEvent---------------------------------------------------------------
 
 //! The GameSpaceEvent execution begins here.
 //! Create a GameSpaceEvent and pass it a reference to the World data.
-//! Passes a name for the event as a QString to the base class.
 //! \param world is a reference to the World data.
 GameSpaceEvent::GameSpaceEvent( World & world ) :
-    Event( "GameSpaceEvent" ),
     mWorld( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "GameSpaceEvent( World & world )...";
@@ -988,13 +1006,12 @@ GameSpaceEvent::~GameSpaceEvent()
     TraceOut( TRACE_FILE_EXECUTION ) << "~GameSpaceEvent()...";
 } // GameSpaceEvent::~GameSpaceEvent()
 
-//! Called periodically to check if Event occured.
-//! Class derived from Event must implement to test for event.
-//! \return State * is a pointer to the state to transition to.
-//! \sa Event, State, Machine
-State * GameSpaceEvent::test()
+//! Called by the StaticMachine to test the Trigger while a Bus topic of its TOPICS is pending.
+//! \return bool is true when the condition occurred, to transition.
+//! \sa StaticMachine, Bus
+bool GameSpaceEvent::test()
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "GameSpaceEvent::process...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "GameSpaceEvent::test()...";
 
     //! If Space equals true
     if( mWorld.getSpace() == true )
@@ -1002,12 +1019,12 @@ State * GameSpaceEvent::test()
         TraceOut( TRACE_FILE_EXECUTION ) << "Event occured...";
         //! The Event has been triggered so reset the condition.
         mWorld.setSpace( false );
-        //! Return the State to transition to.
-        return mpState;
+        //! Return true to transition.
+        return true;
     }
 
-    //! Else don't return a State
-    return NULL;
+    //! Else don't transition.
+    return false;
 } // GameSpaceEvent::test()
 
 
@@ -1018,15 +1035,11 @@ State * GameSpaceEvent::test()
 
 //! The Game execution begins here.
 //! Create a Game and pass it a reference to the World data.
-//! Passes a name for the Machine as a QString to the base class.
 //! \param world is a reference to the World data.
 Game::Game( World & world ) :
-    Machine( "Game" ), mWorld( world )
+    mWorld( world ), mMachine( world )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Game::Game( World & world )...";
-
-    //! Configure the Game State Machine
-    configure();
 } // Game::Game( World & world )
 
 //! The Machine execution ends here.
@@ -1037,110 +1050,14 @@ Game::~Game()
     TraceOut( TRACE_FILE_EXECUTION ) << "Game::~Game()...";
 } // Game::~Game()
 
-//! Called to configure the Game Machine.
-//! \return void
-//! \sa Event, State, Machine
-void Game::configure()
+//! Process received events by passing them to the current State.
+//! \param event is a pointer to a QEvent argument identifing the event.
+//! \return bool is set to true when processed.
+//! \sa QObject, StaticMachine
+bool Game::event( QEvent * event )
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "Game::configure()...";
-
-    //! Create States.
-
-    //! Create GameDiedState.
-    GameDiedState * pGameDiedState = new GameDiedState( mWorld );
-    //! Create GameFinishedState.
-    GameFinishedState * pGameFinishedState = new GameFinishedState( mWorld );
-    //! Create GameMenuState.
-    GameMenuState * pGameMenuState = new GameMenuState( mWorld );
-    //! Create GameOverState.
-    GameOverState * pGameOverState = new GameOverState( mWorld );
-    //! Create GamePlayState.
-    GamePlayState * pGamePlayState = new GamePlayState( mWorld );
-    //! Create GameWonState.
-    GameWonState * pGameWonState = new GameWonState( mWorld );
-
-    //! Create Events.
-
-    //! Create GameDiedEvent.
-    GameDiedEvent * pGameDiedEvent = new GameDiedEvent( mWorld );
-    //! Create GameReturnEvent.
-    GameReturnEvent * pGameReturnEvent = new GameReturnEvent( mWorld );
-    //! Create GameFinishedEvent.
-    GameFinishedEvent * pGameFinishedEvent = new GameFinishedEvent( mWorld );
-    //! Create GameLastLevelEvent.
-    GameLastLevelEvent * pGameLastLevelEvent = new GameLastLevelEvent( mWorld );
-    //! Create GameLastLifeEvent.
-    GameLastLifeEvent * pGameLastLifeEvent = new GameLastLifeEvent( mWorld );
-    //! Create GameSpaceEvent.
-    GameSpaceEvent * pGameSpaceEvent = new GameSpaceEvent( mWorld );
-
-    //! Set Event Transitiions.
-
-    //! Set GameDiedEvent transitiions to GameDiedState.
-    pGameDiedEvent->setTransitionState( pGameDiedState );
-    //! Set GameReturnEvent transitiions to GameMenuState.
-    pGameReturnEvent->setTransitionState( pGameMenuState );
-    //! Set GameFinishedEvent transitiions to GameFinishedState.
-    pGameFinishedEvent->setTransitionState( pGameFinishedState );
-    //! Set GameLastLevelEvent transitiions to GameWonState.
-    pGameLastLevelEvent->setTransitionState( pGameWonState );
-    //! Set GameLastLifeEvent transitiions to GameOverState.
-    pGameLastLifeEvent->setTransitionState( pGameOverState );
-    //! Set GameSpaceEvent transitiions to GamePlayState.
-    pGameSpaceEvent->setTransitionState( pGamePlayState );
-
-    //! Add Events to the States.
-
-    //! Add GameLastLifeEvent to GameDiedState.
-    pGameDiedState->addEvent( pGameLastLifeEvent );
-    //! Add GameSpaceEvent to GameDiedState.
-    pGameDiedState->addEvent( pGameSpaceEvent );
-    //! Add GameLastLevelEvent to GameFinishedState.
-    pGameFinishedState->addEvent( pGameLastLevelEvent );
-    //! Add GameSpaceEvent to GameFinishedState.
-    pGameFinishedState->addEvent( pGameSpaceEvent );
-    //! Add GameSpaceEvent to GameMenuState.
-    pGameMenuState->addEvent( pGameSpaceEvent );
-    //! Add GameDiedEvent to GamePlayState.
-    pGamePlayState->addEvent( pGameDiedEvent );
-    //! Add GameFinishedEvent to GamePlayState.
-    pGamePlayState->addEvent( pGameFinishedEvent );
-    //! Add GameReturnEvent to GameOverState.
-    pGameOverState->addEvent( pGameReturnEvent );
-    //! Add GameReturnEvent to GameWonState.
-    pGameWonState->addEvent( pGameReturnEvent );
-
-
-    //! Add Events to Machine so it can release resources when destructed.
-
-    //! Add GameDiedEvent.
-    addEvent( pGameDiedEvent );
-    //! Add GameReturnEvent.
-    addEvent( pGameReturnEvent );
-    //! Add GameFinishedEvent.
-    addEvent( pGameFinishedEvent );
-    //! Add GameLastLevelEvent.
-    addEvent( pGameLastLevelEvent );
-    //! Add GameLastLifeEvent.
-    addEvent( pGameLastLifeEvent );
-    //! Add GameSpaceEvent.
-    addEvent( pGameSpaceEvent );
-
-    //! Add States to Machine so it can release resources when destructed.
-
-    //! Add GameDiedState.
-    addState( pGameDiedState );
-    //! Add GameFinishedState.
-    addState( pGameFinishedState );
-    //! Add GameMenuState.
-    addState( pGameMenuState );
-    //! Add GameOverState.
-    addState( pGameOverState );
-    //! Add GamePlayState.
-    addState( pGamePlayState );
-    //! Add GameWonState.
-    addState( pGameWonState );
-
-    //! Set the start State.
-    setStartState( pGameMenuState );
-} // Game::configure()
+    TraceOut( TRACE_FILE_EXECUTION ) << "Game::event( QEvent * event )...";
+
+    //! Pass the event to the current State.
+    return mMachine.event( event );
+} // Game::event( QEvent * event )
@@ -5,8 +5,11 @@ This file contains the Game class declaration for the application.
 #ifndef GAME_H
 #define GAME_H
 
-// machine.h header file required for Machine class definition.
-#include "machine.h"
+// QObject header file required for events.
+#include <QObject>
+
+// staticmachine.h header file required for StaticMachine class definition.
+#include "staticmachine.h"
 // world.h header file required for World class definition.
 #include "world.h"
 
@@ -19,10 +22,10 @@ This file contains the Game class declaration for the application.
 /*!
 This class declaration encapsulates the GameDiedState functionality.
 */
-class GameDiedState : public State
+class GameDiedState
 {
-    //! Friend of Game so that only Game can instantiate the GameDiedState.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameDiedState.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameDiedState class constructor.
@@ -33,19 +36,19 @@ private: // Constructors / Destructors
 
 private: // Member Function
     //! Triggered when entering.
-    virtual void enter();
+    void enter();
 
     //! Triggered when an event message is received.
-    virtual bool event( QEvent * event );
+    bool event( QEvent * event );
 
     //! Triggered when exiting.
-    virtual void exit();
+    void exit();
 
     //! Triggered after a tick or when ever scene needs to be rendered.
-    virtual void render();
+    void render();
 
     //! Triggered periodically.
-    virtual void tick();
+    void tick();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -56,10 +59,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameFinishedState functionality.
 */
-class GameFinishedState : public State
+class GameFinishedState
 {
-    //! Friend of Game so that only Game can instantiate the GameFinishedState.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameFinishedState.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameFinishedState class constructor.
@@ -70,19 +73,19 @@ private: // Constructors / Destructors
 
 private: // Member Function
     //! Triggered when entering.
-    virtual void enter();
+    void enter();
 
     //! Triggered when an event message is received.
-    virtual bool event( QEvent * event );
+    bool event( QEvent * event );
 
     //! Triggered when exiting.
-    virtual void exit();
+    void exit();
 
     //! Triggered after a tick or when ever scene needs to be rendered.
-    virtual void render();
+    void render();
 
     //! Triggered periodically.
-    virtual void tick();
+    void tick();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -93,10 +96,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameMenuState functionality.
 */
-class GameMenuState : public State
+class GameMenuState
 {
-    //! Friend of Game so that only Game can instantiate the GameMenuState.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameMenuState.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameMenuState class constructor.
@@ -107,19 +110,19 @@ private: // Constructors / Destructors
 
 private: // Member Function
     //! Triggered when entering.
-    virtual void enter();
+    void enter();
 
     //! Triggered when an event message is received.
-    virtual bool event( QEvent * event );
+    bool event( QEvent * event );
 
     //! Triggered when exiting.
-    virtual void exit();
+    void exit();
 
     //! Triggered after a tick or when ever scene needs to be rendered.
-    virtual void render();
+    void render();
 
     //! Triggered periodically.
-    virtual void tick();
+    void tick();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -130,10 +133,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameOverState functionality.
 */
-class GameOverState : public State
+class GameOverState
 {
-    //! Friend of Game so that only Game can instantiate the GameOverState.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameOverState.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameOverState class constructor.
@@ -144,19 +147,19 @@ private: // Constructors / Destructors
 
 private: // Member Function
     //! Triggered when entering.
-    virtual void enter();
+    void enter();
 
     //! Triggered when an event message is received.
-    virtual bool event( QEvent * event );
+    bool event( QEvent * event );
 
     //! Triggered when exiting.
-    virtual void exit();
+    void exit();
 
     //! Triggered after a tick or when ever scene needs to be rendered.
-    virtual void render();
+    void render();
 
     //! Triggered periodically.
-    virtual void tick();
+    void tick();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -167,10 +170,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GamePlayState functionality.
 */
-class GamePlayState : public State
+class GamePlayState
 {
-    //! Friend of Game so that only Game can instantiate the GamePlayState.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GamePlayState.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GamePlayState class constructor.
@@ -181,19 +184,19 @@ private: // Constructors / Destructors
 
 private: // Member Function
     //! Triggered when entering.
-    virtual void enter();
+    void enter();
 
     //! Triggered when an event message is received.
-    virtual bool event( QEvent * event );
+    bool event( QEvent * event );
 
     //! Triggered when exiting.
-    virtual void exit();
+    void exit();
 
     //! Triggered after a tick or when ever scene needs to be rendered.
-    virtual void render();
+    void render();
 
     //! Triggered periodically.
-    virtual void tick();
+    void tick();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -204,10 +207,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameWonState functionality.
 */
-class GameWonState : public State
+class GameWonState
 {
-    //! Friend of Game so that only Game can instantiate the GameWonState.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameWonState.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameWonState class constructor.
@@ -218,19 +221,19 @@ private: // Constructors / Destructors
 
 private: // Member Function
     //! Triggered when entering.
-    virtual void enter();
+    void enter();
 
     //! Triggered when an event message is received.
-    virtual bool event( QEvent * event );
+    bool event( QEvent * event );
 
     //! Triggered when exiting.
-    virtual void exit();
+    void exit();
 
     //! Triggered after a tick or when ever scene needs to be rendered.
-    virtual void render();
+    void render();
 
     //! Triggered periodically.
-    virtual void tick();
+    void tick();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -247,10 +250,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameDiedEvent functionality.
 */
-class GameDiedEvent : public Event
+class GameDiedEvent
 {
-    //! Friend of Game so that only Game can instantiate the GameDiedEvent.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameDiedEvent.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameDiedEvent class constructor.
@@ -259,9 +262,13 @@ private: // Constructors / Destructors
     //! GameDiedEvent class destructor.
     ~GameDiedEvent();
 
+private: // Data Constants
+    //! The Bus topics that can change the test result, the Player leaving the Level.
+    static const unsigned int TOPICS = Bus::TOPIC_LEFT_LEVEL | Bus::TOPIC_STATE_ENTERED;
+
 private: // Member Function
-    //! Test Event condition triggered.
-    virtual State * test();
+    //! Called to test the Trigger condition, true to transition.
+    bool test();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -272,10 +279,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameReturnEvent functionality.
 */
-class GameReturnEvent : public Event
+class GameReturnEvent
 {
-    //! Friend of Game so that only Game can instantiate the GameReturnEvent.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameReturnEvent.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameReturnEvent class constructor.
@@ -284,9 +291,13 @@ private: // Constructors / Destructors
     //! GameReturnEvent class destructor.
     ~GameReturnEvent();
 
+private: // Data Constants
+    //! The Bus topics that can change the test result, the Return Key condition being set.
+    static const unsigned int TOPICS = Bus::TOPIC_REQUEST | Bus::TOPIC_STATE_ENTERED;
+
 private: // Member Function
-    //! Test Event condition triggered.
-    virtual State * test();
+    //! Called to test the Trigger condition, true to transition.
+    bool test();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -297,10 +308,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameFinishedEvent functionality.
 */
-class GameFinishedEvent : public Event
+class GameFinishedEvent
 {
-    //! Friend of Game so that only Game can instantiate the GameFinishedEvent.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameFinishedEvent.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameFinishedEvent class constructor.
@@ -309,9 +320,13 @@ private: // Constructors / Destructors
     //! GameFinishedEvent class destructor.
     ~GameFinishedEvent();
 
+private: // Data Constants
+    //! The Bus topics that can change the test result, the Player entering a new cell or landing on a Cube.
+    static const unsigned int TOPICS = Bus::TOPIC_ENTERED_CELL | Bus::TOPIC_LANDED_ON_TYPE | Bus::TOPIC_STATE_ENTERED;
+
 private: // Member Function
-    //! Test Event condition triggered.
-    virtual State * test();
+    //! Called to test the Trigger condition, true to transition.
+    bool test();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -322,10 +337,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameLastLevelEvent functionality.
 */
-class GameLastLevelEvent : public Event
+class GameLastLevelEvent
 {
-    //! Friend of Game so that only Game can instantiate the GameLastLevelEvent.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameLastLevelEvent.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameLastLevelEvent class constructor.
@@ -334,9 +349,13 @@ private: // Constructors / Destructors
     //! GameLastLevelEvent class destructor.
     ~GameLastLevelEvent();
 
+private: // Data Constants
+    //! The Bus topics that can change the test result, entering the State.
+    static const unsigned int TOPICS = Bus::TOPIC_STATE_ENTERED;
+
 private: // Member Function
-    //! Test Event condition triggered.
-    virtual State * test();
+    //! Called to test the Trigger condition, true to transition.
+    bool test();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -347,10 +366,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameLastLifeEvent functionality.
 */
-class GameLastLifeEvent : public Event
+class GameLastLifeEvent
 {
-    //! Friend of Game so that only Game can instantiate the GameLastLifeEvent.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameLastLifeEvent.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameLastLifeEvent class constructor.
@@ -359,9 +378,13 @@ private: // Constructors / Destructors
     //! GameLastLifeEvent class destructor.
     ~GameLastLifeEvent();
 
+private: // Data Constants
+    //! The Bus topics that can change the test result, entering the State.
+    static const unsigned int TOPICS = Bus::TOPIC_STATE_ENTERED;
+
 private: // Member Function
-    //! Test Event condition triggered.
-    virtual State * test();
+    //! Called to test the Trigger condition, true to transition.
+    bool test();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -372,10 +395,10 @@ private: // Member Variables
 /*!
 This class declaration encapsulates the GameSpaceEvent functionality.
 */
-class GameSpaceEvent : public Event
+class GameSpaceEvent
 {
-    //! Friend of Game so that only Game can instantiate the GameSpaceEvent.
-    friend class Game;
+    //! Friend of StaticMachine so that only the Game StaticMachine can instantiate the GameSpaceEvent.
+    template< typename Context, typename StateList, typename TransitionList > friend class StaticMachine;
 
 private: // Constructors / Destructors
     //! GameSpaceEvent class constructor.
@@ -384,9 +407,13 @@ private: // Constructors / Destructors
     //! GameSpaceEvent class destructor.
     ~GameSpaceEvent();
 
+private: // Data Constants
+    //! The Bus topics that can change the test result, the Space Key condition being set.
+    static const unsigned int TOPICS = Bus::TOPIC_REQUEST | Bus::TOPIC_STATE_ENTERED;
+
 private: // Member Function
-    //! Test Event condition triggered.
-    virtual State * test();
+    //! Called to test the Trigger condition, true to transition.
+    bool test();
 
 private: // Member Variables
     //! Used to reference the World functionality.
@@ -404,11 +431,21 @@ private: // Member Variables
 This class declaration encapsulates the Game functionality.
 The Engine instantiates a Game to manage the Game State Machine.
 */
-class Game : public Machine
+class Game : public QObject
 {
     //! Friend of Engine so that only Engine can instantiate the Game.
     friend class Engine;
 
+public: // Member Functions
+    //! Call to render the Game.
+    void render() { mMachine.render(); }
+
+    //! Call once to start the Game before calling tick.
+    void start() { mMachine.start(); }
+
+    //! Call periodically to update the Game.
+    void tick() { mMachine.tick(); }
+
 private: // Constructors / Destructors
     //! Game class constructor.
     Game( World & world );
@@ -417,13 +454,34 @@ private: // Constructors / Destructors
     ~Game();
 
 private: // Member Function
-    //! Configure the Machine.
-    void configure();
+    //! Triggered when an event message is received.
+    virtual bool event( QEvent * event );
+
+private: // Data Types
+    //! The Game State Machine, GameMenuState is the start State.
+    typedef StaticMachine< World,
+        TypeList< GameMenuState,
+                  GameDiedState,
+                  GameFinishedState,
+                  GameOverState,
+                  GamePlayState,
+                  GameWonState >,
+        TypeList< Transition< GameDiedState,     GameLastLifeEvent,  GameOverState     >,
+                  Transition< GameDiedState,     GameSpaceEvent,     GamePlayState     >,
+                  Transition< GameFinishedState, GameLastLevelEvent, GameWonState      >,
+                  Transition< GameFinishedState, GameSpaceEvent,     GamePlayState     >,
+                  Transition< GameMenuState,     GameSpaceEvent,     GamePlayState     >,
+                  Transition< GameOverState,     GameReturnEvent,    GameMenuState     >,
+                  Transition< GamePlayState,     GameDiedEvent,      GameDiedState     >,
+                  Transition< GamePlayState,     GameFinishedEvent,  GameFinishedState >,
+                  Transition< GameWonState,      GameReturnEvent,    GameMenuState     > > > GameMachine;
 
 private: // Member Variables
     //! Used to reference the World functionality.
     World & mWorld;
+
+    //! Used to run the Game State Machine.
+    GameMachine mMachine;
 }; // class Game
 
 #endif // GAME_H
-
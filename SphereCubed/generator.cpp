@@ -0,0 +1,310 @@
+/*! \file generator.cpp
+\brief Generator class implementation file.
+This file contains the Generator class implementation for the application.
+*/
+
+// generator.h header file required for Generator class definition.
+#include "generator.h"
+
+// QElapsedTimer header file required for timing the generation.
+#include <QElapsedTimer>
+// QFile header file required for writing the Level file.
+#include <QFile>
+// QtConcurrent header file required for generating rows in parallel.
+#include <QtConcurrent>
+
+// cstring header file required for filling the border rows.
+#include <cstring>
+// random header file required for the seeded generators.
+#include <random>
+
+// chunkstore.h header file required for writing chunk files.
+#include "chunkstore.h"
+// cube.h header file required for the Cube types.
+#include "cube.h"
+// settings.h header file required for the sizes the Generator is meant for.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Number of rows generated per parallel batch, bounds the memory held before writing.
+#define GENERATOR_ROW_BATCH 256
+
+//! Get a chance from 0 up to 1 out of the next mt19937 output, its top 24 bits scaled exactly.
+//! The standard distributions are left to each standard library, this mapping is not.
+//! \param random is the seeded generator.
+//! \return float is the chance.
+static inline float generatorChance( std::mt19937 & random )
+{
+    return (float)( ( random() & 0xFFFFFFFFu ) >> 8 ) * ( 1.0f / 16777216.0f );
+} // generatorChance()
+
+//! Get a height from 0 to a maximum out of the next mt19937 output, scaled with a multiply and a shift.
+//! \param random is the seeded generator.
+//! \param maximum is the maximum height.
+//! \return uint is the height.
+static inline uint generatorHeight( std::mt19937 & random, uint maximum )
+{
+    return (uint)( ( (quint64)( random() & 0xFFFFFFFFu ) * ( maximum + 1 ) ) >> 32 );
+} // generatorHeight()
+
+//! The Generator execution begins here.
+//! Create a Generator.
+//! \param columns is the width of the Level in Cubes.
+//! \param rows is the depth of the Level in Cubes.
+//! \param holeDensity is the chance from 0 to 1 of a non path cell being a hole.
+//! \param heightVariance is the maximum Cube height.
+//! \param seed is the generation seed.
+Generator::Generator( uint columns, uint rows, float holeDensity, uint heightVariance, quint32 seed ) :
+    mColumns( columns ),
+    mRows( rows ),
+    mHoleDensity( holeDensity ),
+    mHeightVariance( heightVariance ),
+    mSeed( seed ),
+    mOut( stdout )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Generator::Generator()...";
+} // Generator::Generator()
+
+//! The Generator execution ends here.
+//! Destroy the Generator.
+Generator::~Generator()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Generator::~Generator()...";
+} // Generator::~Generator()
+
+//! Carve a path from the start in the top left to the finish in the bottom right.
+//! The path only steps right or down and its height never rises, so the Player can always roll it.
+//! \return void
+void Generator::carvePath()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Generator::carvePath()...";
+
+    //! The path has its own generator so it does not depend on the row generators.
+    std::seed_seq sequence{ mSeed, 0xFFFFFFFFu };
+    std::mt19937 random( sequence );
+
+    //! Path runs inside the border ring.
+    uint x = 1;
+    uint z = 1;
+    uint height = mHeightVariance;
+    uint right = mColumns - 3;
+    uint down  = mRows - 3;
+
+    //! Spread the height drops evenly over the path on average.
+    float dropChance = ( right + down ) > 0 ? (float)mHeightVariance / ( right + down ) : 0.0f;
+
+    mPath.clear();
+    mPath.reserve( right + down + 1 );
+    mPathRowStart.fill( 0, mRows + 1 );
+
+    forever
+    {
+        //! Record the cell.
+        PathCell cell;
+        cell.x = x;
+        cell.height = height;
+        mPath.append( cell );
+
+        //! Stop at the finish.
+        if( right == 0 && down == 0 )
+        {
+            break;
+        }
+
+        //! Step right or down, weighted by the steps left so the path wanders across the Level.
+        if( generatorChance( random ) * ( right + down ) < right )
+        {
+            x++;
+            right--;
+        }
+        else
+        {
+            //! Path cells of the next row start here.
+            z++;
+            down--;
+            mPathRowStart[z] = mPath.size();
+        }
+
+        //! Sometimes drop by one, never rise.
+        if( height > 0 && generatorChance( random ) < dropChance )
+        {
+            height--;
+        }
+    } // forever
+
+    //! Rows after the path end have no path cells.
+    for( uint row = z + 1; row <= mRows; row++ )
+    {
+        mPathRowStart[row] = mPath.size();
+    }
+} // Generator::carvePath()
+
+//! Generate the CubeType and height of every cell of one row.
+//! Each row has its own seeded generator so rows can be generated in any order on any thread.
+//! \param row is the row index.
+//! \param types is the array of the row CubeTypes to fill.
+//! \param cellHeights is the array of the row heights to fill.
+//! \return void
+void Generator::generateCells( uint row, quint8 * types, quint8 * cellHeights ) const
+{
+    std::seed_seq sequence{ mSeed, (quint32)row };
+    std::mt19937 random( sequence );
+
+    //! Fill the row with random Cubes and holes.
+    for( uint x = 0; x < mColumns; x++ )
+    {
+        //! Always draw both values so the sequence does not depend on the outcome.
+        bool hole = generatorChance( random ) < mHoleDensity;
+        cellHeights[x] = generatorHeight( random, mHeightVariance );
+        types[x] = hole ? Cube::HOLE : Cube::STANDARD;
+    }
+
+    //! Wall the Level in with a border ring higher than any Cube.
+    if( row == 0 || row == mRows - 1 )
+    {
+        memset( types, Cube::STANDARD, mColumns );
+        memset( cellHeights, mHeightVariance + 1, mColumns );
+    }
+    else
+    {
+        types[0] = types[mColumns - 1] = Cube::STANDARD;
+        cellHeights[0] = cellHeights[mColumns - 1] = mHeightVariance + 1;
+    }
+
+    //! Lay the carved path over the row.
+    for( int i = mPathRowStart[row]; i < mPathRowStart[row + 1]; i++ )
+    {
+        types[ mPath[i].x ] = Cube::STANDARD;
+        cellHeights[ mPath[i].x ] = mPath[i].height;
+    }
+
+    //! Mark the start and finish.
+    if( row == 1 )
+    {
+        types[1] = Cube::START;
+    }
+
+    if( row == mRows - 2 )
+    {
+        types[mColumns - 2] = Cube::FINISH;
+    }
+} // Generator::generateCells( uint row, quint8 * types, quint8 * cellHeights ) const
+
+//! Generate the text of one row.
+//! \param row is the row index.
+//! \return QByteArray is the row text without a line ending.
+QByteArray Generator::generateRow( uint row ) const
+{
+    QVector<quint8> types( mColumns );
+    QVector<quint8> cellHeights( mColumns );
+
+    generateCells( row, types.data(), cellHeights.data() );
+
+    //! Format the row, each cell is 0xTT:0xHH.
+    static const char HEX[] = "0123456789ABCDEF";
+    QByteArray text( mColumns * 10 - 1, ',' );
+    char * p = text.data();
+
+    for( uint x = 0; x < mColumns; x++ )
+    {
+        p[0] = '0'; p[1] = 'x'; p[2] = HEX[ ( types[x] >> 4 ) & 0xF ]; p[3] = HEX[ types[x] & 0xF ];
+        p[4] = ':';
+        p[5] = '0'; p[6] = 'x'; p[7] = HEX[ ( cellHeights[x] >> 4 ) & 0xF ]; p[8] = HEX[ cellHeights[x] & 0xF ];
+        p += 10;
+    }
+
+    return text;
+} // Generator::generateRow( uint row ) const
+
+//! Generate the Level and write it to a file.
+//! \param path is the Level file path to write.
+//! \param chunked is true to write a chunk file instead of a text Level file.
+//! \return int is the process exit status, zero on success.
+int Generator::write( const QString & path, bool chunked )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Generator::write()...";
+
+    //! The Level needs a border, a start, and a finish, and the heights must fit in a byte.
+    if( mColumns < 4 || mRows < 4 || mHeightVariance > 0xFE || mHoleDensity < 0.0f || mHoleDensity > 1.0f )
+    {
+        mOut << "Invalid generator settings" << endl;
+        return 1;
+    }
+
+    //! Other sizes are generated, but the Generator is meant for scaling tests between these.
+    if( mColumns < GENERATOR_MIN_SIZE || mColumns > GENERATOR_MAX_SIZE || mRows < GENERATOR_MIN_SIZE || mRows > GENERATOR_MAX_SIZE )
+    {
+        mOut << "Warning: " << mColumns << "x" << mRows << " is outside the " << GENERATOR_MIN_SIZE << " to "
+             << GENERATOR_MAX_SIZE << " columns and rows the generator is meant for" << endl;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    //! Carve the path before the rows, the rows read it.
+    carvePath();
+
+    //! A chunk file is written a band of rows at a time by the ChunkStore, so a Level too
+    //! large for memory can be generated.
+    if( chunked == true )
+    {
+        if( ChunkStore::write( path, mColumns, mRows, [ this ]( uint row, quint8 * pType, quint8 * pHeight )
+        {
+            generateCells( row, pType, pHeight );
+        } ) == false )
+        {
+            mOut << "Unable to write " << path << endl;
+            return 1;
+        }
+
+        mOut << "Generated " << mColumns << "x" << mRows << " chunked level " << path << " in " << timer.elapsed() << " mS" << endl;
+
+        return 0;
+    } // if( chunked == true )
+
+    QFile file( path );
+
+    if( file.open( QIODevice::WriteOnly | QIODevice::Truncate ) == false )
+    {
+        mOut << "Unable to open " << path << endl;
+        return 1;
+    }
+
+    //! Generate the rows in parallel one batch at a time and write them in order.
+    QVector<QByteArray> rows;
+
+    for( uint first = 0; first < mRows; first += GENERATOR_ROW_BATCH )
+    {
+        uint count = qMin( (uint)GENERATOR_ROW_BATCH, mRows - first );
+
+        QVector<uint> indices( count );
+        for( uint i = 0; i < count; i++ )
+        {
+            indices[i] = first + i;
+        }
+
+        rows.fill( QByteArray(), count );
+        QByteArray * pRows = rows.data();
+
+        QtConcurrent::blockingMap( indices, [ this, first, pRows ]( uint & row )
+        {
+            pRows[ row - first ] = generateRow( row );
+        } );
+
+        for( uint i = 0; i < count; i++ )
+        {
+            file.write( rows[i] );
+            file.write( "\n", 1 );
+        }
+    } // for( uint first = 0; first < mRows; first += GENERATOR_ROW_BATCH )
+
+    file.close();
+
+    mOut << "Generated " << mColumns << "x" << mRows << " level " << path << " in " << timer.elapsed() << " mS" << endl;
+
+    return 0;
+} // Generator::write( const QString & path, bool chunked )
@@ -0,0 +1,87 @@
+/*! \file generator.h
+\brief Generator class declaration file.
+This file contains the Generator class declaration for the application.
+*/
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+// QByteArray header file required for row text.
+#include <QByteArray>
+// QString header file required for file paths.
+#include <QString>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for path storage.
+#include <QVector>
+
+//! Generator class.
+/*!
+This class declaration encapsulates the procedural Level Generator functionality.
+Level files of any number of columns and rows are written with a configurable hole
+density and height variance, as text or as a chunk file for Levels too large for memory.
+A path from the start to the finish whose height never rises is carved first, so the
+finish is always reachable. Generation is seeded per row so the output is identical no
+matter how many threads generate the rows, and the random values are mapped from the
+mt19937 output by the Generator itself, so it is identical with any standard library.
+*/
+class Generator
+{
+public: // Constructors / Destructors
+    //! Generator class constructor.
+    Generator( uint columns, uint rows, float holeDensity, uint heightVariance, quint32 seed );
+
+    //! Generator class destructor.
+    ~Generator();
+
+public: // Member Functions
+    //! Called to generate the Level and write it to a text Level file or a chunk file.
+    int write( const QString & path, bool chunked );
+
+private: // Data Types
+    //! Internal carved path cell.
+    struct PathCell
+    {
+        //! - Column of the cell.
+        uint x;
+        //! - Height of the cell.
+        uint height;
+    }; // struct PathCell
+
+private: // Member Variables
+    //! Used to store the Level width in Cubes.
+    uint mColumns;
+
+    //! Used to store the Level depth in Cubes.
+    uint mRows;
+
+    //! Used to store the chance of a non path cell being a hole.
+    float mHoleDensity;
+
+    //! Used to store the maximum Cube height.
+    uint mHeightVariance;
+
+    //! Used to store the generation seed.
+    quint32 mSeed;
+
+    //! Used to store the carved path cells, ordered by row.
+    QVector<PathCell> mPath;
+
+    //! Used to store the index of the first path cell of each row.
+    QVector<int> mPathRowStart;
+
+    //! Used to write the report.
+    QTextStream mOut;
+
+private: // Helper Functions
+    //! Called to carve the start to finish path.
+    void carvePath();
+
+    //! Called to generate the cells of one row.
+    void generateCells( uint row, quint8 * types, quint8 * cellHeights ) const;
+
+    //! Called to generate the text of one row.
+    QByteArray generateRow( uint row ) const;
+}; // class Generator
+
+#endif // GENERATOR_H
@@ -0,0 +1,206 @@
+/*! \file input.cpp
+\brief Input class implementation file.
+This file contains the Input class implementation for the application.
+*/
+
+// input.h header file required for Input class definition.
+#include "input.h"
+
+// QKeyEvent header file required for processing key events.
+#include <QKeyEvent>
+// QtGlobal header file required for qMax.
+#include <QtGlobal>
+
+// chrono header file required for the monotonic time stamps.
+#include <chrono>
+
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The Input execution begins here.
+//! Automatically called when the Player is constructed.
+Input::Input()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Input::Input()...";
+
+    //! Start with every key released.
+    reset();
+} // Input::Input()
+
+//! The Input execution ends here.
+//! Automatically called when the Player is destructed.
+Input::~Input()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Input::~Input()...";
+} // Input::~Input()
+
+//! Apply the oldest recorded transition to the held durations.
+//! \return void
+void Input::consume()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Input::consume()...";
+
+    const Transition & transition = mRing[ mHead ];
+    Key key = transition.key;
+
+    //! A transition recorded before the sample began counts from the start of the sample.
+    qint64 time = qMax( transition.time, mSince[ key ] );
+
+    //! If the key was held, add the time held up to the transition.
+    if( mPressed[ key ] == true )
+    {
+        mHeld[ key ] += time - mSince[ key ];
+    } // if( mPressed[ key ] == true )
+
+    //! Change the key state.
+    mPressed[ key ] = transition.pressed;
+    mSince[ key ] = time;
+
+    //! Drop the transition from the ring.
+    mHead = ( mHead + 1 ) % INPUT_RING_SIZE;
+    mCount--;
+} // Input::consume()
+
+//! Record a key event, time stamped now.
+//! Operating system auto repeat events are swallowed, a held key is already integrated.
+//! \param event is a pointer to a QEvent argument identifing the event.
+//! \return bool is true when the event was a Player key.
+bool Input::event( QEvent * event )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Input::event( QEvent * event )...";
+
+    //! Only key presses and releases are recorded.
+    if( event->type() != QEvent::KeyPress && event->type() != QEvent::KeyRelease )
+    {
+        return false;
+    }
+
+    //! Only the Player keys are recorded.
+    QKeyEvent * keyEvent = (QKeyEvent*)event;
+    Key playerKey;
+    if( key( keyEvent->key(), playerKey ) == false )
+    {
+        return false;
+    }
+
+    //! Record the transition unless it is an auto repeat.
+    if( keyEvent->isAutoRepeat() == false )
+    {
+        transition( playerKey, event->type() == QEvent::KeyPress, now() );
+    } // if( keyEvent->isAutoRepeat() == false )
+
+    return true;
+} // Input::event( QEvent * event )
+
+//! Map a Qt key code to a Player key.
+//! \param qtKey is the Qt key code.
+//! \param key is set to the Player key.
+//! \return bool is false when the key is not a Player key.
+bool Input::key( int qtKey, Key & key )
+{
+    switch( qtKey )
+    {
+    case Qt::Key_Up:    key = KEY_UP;    return true;
+    case Qt::Key_Down:  key = KEY_DOWN;  return true;
+    case Qt::Key_Left:  key = KEY_LEFT;  return true;
+    case Qt::Key_Right: key = KEY_RIGHT; return true;
+    default:            return false;
+    } // switch( qtKey )
+} // Input::key( int qtKey, Key & key )
+
+//! Get the monotonic time stamp transitions are recorded with.
+//! The clock is shared by every thread, so transitions can be recorded on one thread
+//! and sampled on another.
+//! \return qint64 is the time in nanoseconds.
+qint64 Input::now()
+{
+    return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+} // Input::now()
+
+//! Release every key and drop the recorded transitions.
+//! The next sample covers one interval.
+//! \return void
+void Input::reset()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Input::reset()...";
+
+    mHead = 0;
+    mCount = 0;
+    mLastSample = -1;
+
+    for( int key = 0; key < KEY_COUNT; key++ )
+    {
+        mPressed[ key ] = false;
+        mSince[ key ] = 0;
+        mHeld[ key ] = 0;
+    } // for( int key = 0; key < KEY_COUNT; key++ )
+} // Input::reset()
+
+//! Integrate the time each key was held since the last sample.
+//! Transitions recorded after now are left for the next sample.
+//! \param now is the time stamp to sample up to, in nanoseconds.
+//! \param interval is the time the first sample after a reset covers, in nanoseconds.
+//! \param held is set to the time each key was held, in nanoseconds.
+//! \return void
+void Input::sample( qint64 now, qint64 interval, qint64 held[ KEY_COUNT ] )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Input::sample()...";
+
+    //! The first sample after a reset covers one interval.
+    if( mLastSample < 0 )
+    {
+        for( int key = 0; key < KEY_COUNT; key++ )
+        {
+            mSince[ key ] = qMax( mSince[ key ], now - interval );
+            mHeld[ key ] = 0;
+        } // for( int key = 0; key < KEY_COUNT; key++ )
+    } // if( mLastSample < 0 )
+
+    //! Replay the transitions up to now.
+    while( mCount > 0 && mRing[ mHead ].time <= now )
+    {
+        consume();
+    } // while( mCount > 0 && mRing[ mHead ].time <= now )
+
+    //! Add the time the keys still held have been held up to now, and start the next sample.
+    for( int key = 0; key < KEY_COUNT; key++ )
+    {
+        held[ key ] = mHeld[ key ];
+
+        if( mPressed[ key ] == true )
+        {
+            held[ key ] += now - mSince[ key ];
+        } // if( mPressed[ key ] == true )
+
+        mHeld[ key ] = 0;
+        mSince[ key ] = now;
+    } // for( int key = 0; key < KEY_COUNT; key++ )
+
+    mLastSample = now;
+} // Input::sample( qint64 now, qint64 interval, qint64 held[ KEY_COUNT ] )
+
+//! Record a key transition.
+//! When the ring is full the oldest transition is applied early, only its timing is lost.
+//! \param key is the Player key that changed.
+//! \param pressed is true when pressed, false when released.
+//! \param time is the time stamp of the transition, in nanoseconds.
+//! \return void
+void Input::transition( Key key, bool pressed, qint64 time )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Input::transition()..." << key << pressed;
+
+    //! Make room by applying the oldest transition.
+    if( mCount == INPUT_RING_SIZE )
+    {
+        consume();
+    } // if( mCount == INPUT_RING_SIZE )
+
+    Transition & entry = mRing[ ( mHead + mCount ) % INPUT_RING_SIZE ];
+    entry.time = time;
+    entry.key = key;
+    entry.pressed = pressed;
+    mCount++;
+} // Input::transition( Key key, bool pressed, qint64 time )
@@ -0,0 +1,106 @@
+/*! \file input.h
+\brief Input class declaration file.
+This file contains the Input class declaration for the application.
+*/
+
+#ifndef INPUT_H
+#define INPUT_H
+
+// QEvent header file required for key events.
+#include <QEvent>
+
+// settings.h header file required for the transition ring size.
+#include "settings.h"
+
+//! Input class.
+/*!
+This class declaration encapsulates the Player key Input functionality.
+Key presses and releases are recorded as time stamped transitions in a ring buffer as
+they arrive, operating system auto repeat is ignored. Once per tick the Physics samples
+the Input, which replays the transitions to integrate exactly how long each key was held
+since the last sample, so the user force no longer depends on the key repeat rate or on
+how events batch between ticks.
+*/
+class Input
+{
+    //! Friend of Player so that only Player can instantiate the Input.
+    friend class Player;
+
+public: // Data Types
+    //! Enumeration of the Player keys.
+    enum Key
+    {
+        KEY_UP,    //!< - Up arrow key.
+        KEY_DOWN,  //!< - Down arrow key.
+        KEY_LEFT,  //!< - Left arrow key.
+        KEY_RIGHT, //!< - Right arrow key.
+        KEY_COUNT  //!< - Number of Player keys.
+    }; // enum Key
+
+public: // Static Functions
+    //! Called to map a Qt key code to a Player key.
+    static bool key( int qtKey, Key & key );
+
+    //! Called to get the monotonic time stamp transitions are recorded with, in nanoseconds.
+    static qint64 now();
+
+public: // Member Functions
+    //! Called to record a key event, time stamped now.
+    bool event( QEvent * event );
+
+    //! Called to release every key and drop the recorded transitions.
+    void reset();
+
+    //! Called to integrate the time each key was held since the last sample.
+    void sample( qint64 now, qint64 interval, qint64 held[ KEY_COUNT ] );
+
+    //! Called to record a key transition.
+    void transition( Key key, bool pressed, qint64 time );
+
+private: // Constructors / Destructors
+    //! Input class constructor.
+    Input();
+
+    //! Input class destructor.
+    ~Input();
+
+private: // Data Types
+    //! Internal time stamped key transition.
+    struct Transition
+    {
+        //! - Time stamp in nanoseconds.
+        qint64 time;
+        //! - Key that changed.
+        Key key;
+        //! - True when pressed, false when released.
+        bool pressed;
+    }; // struct Transition
+
+private: // Helper Functions
+    //! Called to apply the oldest recorded transition to the held durations.
+    void consume();
+
+private: // Member Variables
+    //! Used to store the ring of recorded transitions.
+    Transition mRing[ INPUT_RING_SIZE ];
+
+    //! Used to store the index of the oldest recorded transition.
+    uint mHead = 0;
+
+    //! Used to store the number of recorded transitions.
+    uint mCount = 0;
+
+    //! Used to store the key states as of the consumed transitions.
+    bool mPressed[ KEY_COUNT ];
+
+    //! Used to store when each key's current state began, within the sample.
+    qint64 mSince[ KEY_COUNT ];
+
+    //! Used to accumulate the time each key was held within the sample.
+    qint64 mHeld[ KEY_COUNT ];
+
+    //! Used to store the time of the last sample, negative before the first.
+    qint64 mLastSample = -1;
+}; // class Input
+
+#endif // INPUT_H
@@ -0,0 +1,340 @@
+/*! \file jobs.cpp
+\brief Jobs class implementation file.
+This file contains the Jobs system class implementation for the application.
+*/
+
+// jobs.h header file required for Jobs class definition.
+#include "jobs.h"
+
+// QMutexLocker header file required for guarding the queues.
+#include <QMutexLocker>
+// QThread header file required for the number of cores.
+#include <QThread>
+
+// chrono header file required for the utilisation time stamps.
+#include <chrono>
+
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Index of the worker the calling thread is, negative for threads outside the pool.
+static thread_local int tWorker = -1;
+
+//! Get a monotonic time stamp for the utilisation counters.
+//! \return qint64 is the time in nanoseconds.
+static qint64 jobsNow()
+{
+    return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+} // jobsNow()
+
+//! The Jobs execution begins here.
+//! Automatically called on the first use of the Jobs system.
+Jobs::Jobs() :
+    mPending( 0 ),
+    mSleeping( 0 ),
+    mStop( false ),
+    mStarted( jobsNow() )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Jobs::Jobs()...";
+
+    //! Use the configured number of workers, else leave a core for the calling thread.
+    int count = ( JOBS_WORKER_COUNT > 0 ) ? JOBS_WORKER_COUNT : qMax( 1, QThread::idealThreadCount() - 1 );
+
+    //! Create every worker before any starts, so they can steal from each other.
+    for( int self = 0; self < count; self++ )
+    {
+        Worker * pWorker = new Worker;
+        pWorker->executed = 0;
+        pWorker->stolen = 0;
+        pWorker->busy = 0;
+        mWorkers.append( pWorker );
+    } // for( int self = 0; self < count; self++ )
+
+    //! Start the worker threads.
+    for( int self = 0; self < count; self++ )
+    {
+        mWorkers[ self ]->thread = std::thread( &Jobs::work, this, self );
+    } // for( int self = 0; self < count; self++ )
+} // Jobs::Jobs()
+
+//! The Jobs execution ends here.
+//! Automatically called when the process exits.
+Jobs::~Jobs()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Jobs::~Jobs()...";
+
+    //! Wake every worker to stop.
+    {
+        QMutexLocker locker( &mMutex );
+        mStop = true;
+        mWake.wakeAll();
+    }
+
+    //! Wait for the workers to finish and free them.
+    foreach( Worker * pWorker, mWorkers )
+    {
+        pWorker->thread.join();
+        delete pWorker;
+    } // foreach( Worker * pWorker, mWorkers )
+
+    //! Free any Task never run.
+    qDeleteAll( mInjected );
+} // Jobs::~Jobs()
+
+//! Run one queued Task, if any can be found.
+//! \param self is the index of the calling worker, negative for threads outside the pool.
+//! \return bool is false when no Task was found.
+bool Jobs::execute( int self )
+{
+    Task * pTask = take( self );
+
+    //! If there was nothing to run.
+    if( pTask == NULL )
+    {
+        return false;
+    } // if( pTask == NULL )
+
+    //! Run the Job, a worker measures the time it was busy.
+    qint64 start = jobsNow();
+    pTask->job();
+
+    if( self >= 0 )
+    {
+        mWorkers[ self ]->busy += jobsNow() - start;
+        mWorkers[ self ]->executed++;
+    } // if( self >= 0 )
+
+    //! Free the Task before counting it down, a waiter may free the Counter at once.
+    Counter * pCounter = pTask->pCounter;
+    delete pTask;
+    finish( *pCounter );
+
+    return true;
+} // Jobs::execute( int self )
+
+//! Count a finished Task down, and queue the Tasks held by the Counter once it reaches zero.
+//! The count is changed under the Counter mutex, so a waiter that sees zero and takes the
+//! mutex knows the Counter is no longer used.
+//! \param counter is the Counter of the finished Task.
+//! \return void
+void Jobs::finish( Counter & counter )
+{
+    QVector< Task * > released;
+
+    {
+        QMutexLocker locker( &counter.mMutex );
+
+        if( counter.mCount.fetch_sub( 1 ) == 1 )
+        {
+            released.swap( counter.mContinuations );
+        } // if( counter.mCount.fetch_sub( 1 ) == 1 )
+    }
+
+    //! The Counter is not touched from here on.
+    foreach( Task * pTask, released )
+    {
+        submit( pTask );
+    } // foreach( Task * pTask, released )
+} // Jobs::finish( Counter & counter )
+
+//! Get the Jobs system shared by the process.
+//! The workers start on the first call and stop when the process exits.
+//! \return Jobs & is the Jobs system.
+Jobs & Jobs::instance()
+{
+    static Jobs jobs;
+    return jobs;
+} // Jobs::instance()
+
+//! Report the per worker utilisation and steal counters.
+//! \param out is the stream to report to.
+//! \return void
+void Jobs::report( QTextStream & out )
+{
+    qint64 elapsed = qMax( Q_INT64_C( 1 ), jobsNow() - mStarted );
+
+    out << "jobs: " << mWorkers.size() << " workers over " << elapsed / 1000000 << " mS" << endl;
+
+    for( int self = 0; self < mWorkers.size(); self++ )
+    {
+        const Worker * pWorker = mWorkers[ self ];
+
+        out << "jobs: worker " << self
+            << " executed " << pWorker->executed.load()
+            << " stolen " << pWorker->stolen.load()
+            << " utilisation " << QString::number( 100.0 * pWorker->busy.load() / elapsed, 'f', 1 ) << "%" << endl;
+    } // for( int self = 0; self < mWorkers.size(); self++ )
+} // Jobs::report( QTextStream & out )
+
+//! Run a Job, counted by a Counter.
+//! \param job is the Job to run.
+//! \param counter is the Counter of the Job's group, it must outlive the Job.
+//! \return void
+void Jobs::run( const Job & job, Counter & counter )
+{
+    counter.mCount++;
+    submit( new Task{ job, &counter } );
+} // Jobs::run( const Job & job, Counter & counter )
+
+//! Run a Job once a dependency Counter reaches zero, counted by a Counter.
+//! \param job is the Job to run.
+//! \param counter is the Counter of the Job's group, it must outlive the Job.
+//! \param dependency is the Counter to wait for, it must outlive the Job.
+//! \return void
+void Jobs::run( const Job & job, Counter & counter, Counter & dependency )
+{
+    counter.mCount++;
+    Task * pTask = new Task{ job, &counter };
+
+    //! If the dependency has not finished, it queues the Task when it does.
+    {
+        QMutexLocker locker( &dependency.mMutex );
+
+        if( dependency.mCount.load() > 0 )
+        {
+            dependency.mContinuations.append( pTask );
+            return;
+        } // if( dependency.mCount.load() > 0 )
+    }
+
+    submit( pTask );
+} // Jobs::run( const Job & job, Counter & counter, Counter & dependency )
+
+//! Queue a Task on the calling worker's deque, or on the injection queue for threads
+//! outside the pool and when the deque is full, then wake a sleeping worker.
+//! \param pTask is the Task to queue.
+//! \return void
+void Jobs::submit( Task * pTask )
+{
+    //! Count the Task before it can be taken.
+    mPending++;
+
+    //! A worker keeps the Tasks it spawns, else they are injected.
+    if( tWorker < 0 || mWorkers[ tWorker ]->deque.push( pTask ) == false )
+    {
+        QMutexLocker locker( &mMutex );
+        mInjected.enqueue( pTask );
+    } // if( tWorker < 0 || ... )
+
+    //! Only take the mutex to wake a worker when one sleeps.
+    if( mSleeping.load() > 0 )
+    {
+        QMutexLocker locker( &mMutex );
+        mWake.wakeOne();
+    } // if( mSleeping.load() > 0 )
+} // Jobs::submit( Task * pTask )
+
+//! Find a queued Task: the newest of the worker's own deque, else the oldest injected, else
+//! the oldest of another worker's deque.
+//! \param self is the index of the calling worker, negative for threads outside the pool.
+//! \return Task * is the Task taken, NULL when none was found.
+Jobs::Task * Jobs::take( int self )
+{
+    Task * pTask = NULL;
+
+    //! Nothing is queued.
+    if( mPending.load() == 0 )
+    {
+        return NULL;
+    } // if( mPending.load() == 0 )
+
+    //! Try the worker's own deque.
+    if( self >= 0 )
+    {
+        pTask = mWorkers[ self ]->deque.pop();
+    } // if( self >= 0 )
+
+    //! Try the injection queue.
+    if( pTask == NULL )
+    {
+        QMutexLocker locker( &mMutex );
+
+        if( mInjected.isEmpty() == false )
+        {
+            pTask = mInjected.dequeue();
+        } // if( mInjected.isEmpty() == false )
+    } // if( pTask == NULL )
+
+    //! Try stealing from the other workers, starting with the next one.
+    for( int offset = 1; pTask == NULL && offset <= mWorkers.size(); offset++ )
+    {
+        int victim = ( self + offset + mWorkers.size() ) % mWorkers.size();
+
+        if( victim != self )
+        {
+            pTask = mWorkers[ victim ]->deque.steal();
+
+            if( pTask != NULL && self >= 0 )
+            {
+                mWorkers[ self ]->stolen++;
+            } // if( pTask != NULL && self >= 0 )
+        } // if( victim != self )
+    } // for( int offset = 1; ... )
+
+    if( pTask != NULL )
+    {
+        mPending--;
+    } // if( pTask != NULL )
+
+    return pTask;
+} // Jobs::take( int self )
+
+//! Run Jobs until every Job counted by a Counter has finished.
+//! The calling thread never blocks, it runs queued Jobs while it waits.
+//! \param counter is the Counter to wait for.
+//! \return void
+void Jobs::wait( Counter & counter )
+{
+    while( counter.done() == false )
+    {
+        //! Help with the queued Jobs, else let the workers run.
+        if( execute( tWorker ) == false )
+        {
+            std::this_thread::yield();
+        } // if( execute( tWorker ) == false )
+    } // while( counter.done() == false )
+
+    //! Make sure the last finish has let go of the Counter before the caller frees it.
+    QMutexLocker locker( &counter.mMutex );
+} // Jobs::wait( Counter & counter )
+
+//! Run Tasks on a worker thread until the Jobs system stops, sleeping while nothing is queued.
+//! \param self is the index of the worker.
+//! \return void
+void Jobs::work( int self )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Jobs::work()..." << self;
+
+    tWorker = self;
+
+    while( true )
+    {
+        //! Run queued Tasks.
+        if( execute( self ) == true )
+        {
+            continue;
+        } // if( execute( self ) == true )
+
+        //! Sleep until a Task is queued or the Jobs system stops.
+        QMutexLocker locker( &mMutex );
+
+        if( mStop == true )
+        {
+            break;
+        } // if( mStop == true )
+
+        //! Announce the sleep before checking for Tasks, so a submit either sees the
+        //! sleeper or this check sees its Task.
+        mSleeping++;
+
+        if( mPending.load() == 0 )
+        {
+            mWake.wait( &mMutex );
+        } // if( mPending.load() == 0 )
+
+        mSleeping--;
+    } // while( true )
+} // Jobs::work( int self )
@@ -0,0 +1,242 @@
+/*! \file jobs.h
+\brief Jobs class declaration file.
+This file contains the Jobs system class declaration for the application.
+*/
+
+#ifndef JOBS_H
+#define JOBS_H
+
+// QMutex header file required for the injection queue and the Counter continuations.
+#include <QMutex>
+// QQueue header file required for the injection queue.
+#include <QQueue>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for the workers and the Counter continuations.
+#include <QVector>
+// QWaitCondition header file required for sleeping idle workers.
+#include <QWaitCondition>
+// QtGlobal header file required for qMin.
+#include <QtGlobal>
+
+// atomic header file required for the Counter and the statistics.
+#include <atomic>
+// functional header file required for the Job type.
+#include <functional>
+// thread header file required for the worker threads.
+#include <thread>
+
+// settings.h header file required for the worker deque size.
+#include "settings.h"
+// workdeque.h header file required for the per worker deques.
+#include "workdeque.h"
+
+//! Jobs class.
+/*!
+This class declaration encapsulates the engine Jobs system functionality.
+A fixed pool of worker threads runs short Jobs. Every worker owns a Chase-Lev WorkDeque,
+Jobs it spawns are pushed to its own deque and idle workers steal from the others, Jobs
+from any other thread enter through a shared injection queue. A Counter tracks a group of
+Jobs, waiting on it runs Jobs instead of blocking, and Jobs can be held back until a
+Counter reaches zero. parallelFor() splits an index range into Jobs and waits for them.
+The process shares one Jobs system, the Level, the Physics batches and the renderer use it.
+*/
+class Jobs
+{
+private: // Data Types
+    //! Internal queued Job, defined below.
+    struct Task;
+
+public: // Data Types
+    //! A Job is any callable taking no argument.
+    typedef std::function< void() > Job;
+
+    //! Counter class.
+    /*!
+    Counts the Jobs of a group still to finish. Jobs run after a Counter are held by it and
+    released when it reaches zero.
+    */
+    class Counter
+    {
+        //! Friend of Jobs so that only Jobs can change the count.
+        friend class Jobs;
+
+    public: // Constructors / Destructors
+        //! Counter class constructor.
+        Counter() : mCount( 0 ) {}
+
+    public: // Query Functions
+        //! Called to find out if every Job of the group has finished.
+        bool done() const { return ( mCount.load( std::memory_order_acquire ) == 0 ); }
+
+    private: // Constructors / Destructors
+        //! Counters are shared by address and never copied.
+        Counter( const Counter & );
+        Counter & operator=( const Counter & );
+
+    private: // Member Variables
+        //! Used to count the Jobs still to finish.
+        std::atomic< int > mCount;
+
+        //! Used to guard the continuations and the last decrement.
+        QMutex mMutex;
+
+        //! Used to hold the Jobs waiting for the Counter to reach zero.
+        QVector< Task * > mContinuations;
+    }; // class Counter
+
+public: // Static Functions
+    //! Called to get the Jobs system shared by the process, started on first use.
+    static Jobs & instance();
+
+public: // Member Functions
+    //! Called to run a Job, counted by a Counter.
+    void run( const Job & job, Counter & counter );
+
+    //! Called to run a Job once a dependency Counter reaches zero, counted by a Counter.
+    void run( const Job & job, Counter & counter, Counter & dependency );
+
+    //! Called to run Jobs until every Job counted by a Counter has finished.
+    void wait( Counter & counter );
+
+    //! Called to run a function over an index range split into Jobs and wait for them.
+    template< typename Function >
+    void parallelFor( uint begin, uint end, uint grain, const Function & function );
+
+    //! Called to report the per worker utilisation and steal counters.
+    void report( QTextStream & out );
+
+    //! Called to get the number of worker threads.
+    uint workerCount() const { return mWorkers.size(); }
+
+private: // Constructors / Destructors
+    //! Jobs class constructor.
+    Jobs();
+
+    //! Jobs class destructor.
+    ~Jobs();
+
+private: // Data Types
+    //! Internal queued Job.
+    struct Task
+    {
+        //! - The Job to run.
+        Job job;
+        //! - Counter of the Job's group.
+        Counter * pCounter;
+    }; // struct Task
+
+    //! Internal worker thread state, padded so the counters of two workers never share a cache line.
+    struct Worker
+    {
+        //! - The worker thread.
+        std::thread thread;
+        //! - Deque of the Tasks the worker spawned.
+        WorkDeque< Task, JOBS_DEQUE_SIZE > deque;
+        //! - Number of Tasks run.
+        std::atomic< qint64 > executed;
+        //! - Number of Tasks stolen from other workers.
+        std::atomic< qint64 > stolen;
+        //! - Time spent running Tasks, in nanoseconds.
+        std::atomic< qint64 > busy;
+        //! - Padding to keep the counters off the cache line of the next allocation.
+        char padding[ WORKDEQUE_CACHE_LINE ];
+    }; // struct Worker
+
+private: // Helper Functions
+    //! Called to run one queued Task, if any can be found.
+    bool execute( int self );
+
+    //! Called when a Task has finished, to count it down and release its continuations.
+    void finish( Counter & counter );
+
+    //! Called to queue a Task on the calling worker's deque or on the injection queue.
+    void submit( Task * pTask );
+
+    //! Called to find a queued Task for a worker, or for another thread when self is negative.
+    Task * take( int self );
+
+    //! Called on every worker thread to run Tasks until the Jobs system stops.
+    void work( int self );
+
+private: // Member Variables
+    //! Used to store the worker threads.
+    QVector< Worker * > mWorkers;
+
+    //! Used to queue the Tasks run from threads outside the pool.
+    QQueue< Task * > mInjected;
+
+    //! Used to guard the injection queue and to sleep idle workers.
+    QMutex mMutex;
+
+    //! Used to wake idle workers.
+    QWaitCondition mWake;
+
+    //! Used to count the queued Tasks not yet taken.
+    std::atomic< int > mPending;
+
+    //! Used to count the workers sleeping on mWake.
+    std::atomic< int > mSleeping;
+
+    //! Used to request the workers to stop.
+    std::atomic< bool > mStop;
+
+    //! Used to store when the workers started, in nanoseconds.
+    qint64 mStarted;
+}; // class Jobs
+
+//! Run a function over an index range split into Jobs and wait for them.
+//! The calling thread runs Jobs while it waits.
+//! \param begin is the first index.
+//! \param end is one past the last index.
+//! \param grain is the number of indices per Job, zero picks a few Jobs per worker.
+//! \param function is called once with every index of the range.
+//! \return void
+template< typename Function >
+void Jobs::parallelFor( uint begin, uint end, uint grain, const Function & function )
+{
+    //! Nothing to run for an empty range.
+    if( begin >= end )
+    {
+        return;
+    } // if( begin >= end )
+
+    //! Pick a grain that gives every worker a few Jobs to balance.
+    if( grain == 0 )
+    {
+        grain = ( end - begin ) / ( ( workerCount() + 1 ) * JOBS_SPLIT_PER_WORKER ) + 1;
+    } // if( grain == 0 )
+
+    //! A range of a single grain is not worth queueing, run it here.
+    if( end - begin <= grain )
+    {
+        for( uint index = begin; index < end; index++ )
+        {
+            function( index );
+        }
+        return;
+    } // if( end - begin <= grain )
+
+    //! Queue a Job per grain of the range.
+    Counter counter;
+    uint first = begin;
+    while( first < end )
+    {
+        uint last = first + qMin( grain, end - first );
+
+        run( [ &function, first, last ]()
+        {
+            for( uint index = first; index < last; index++ )
+            {
+                function( index );
+            }
+        }, counter );
+
+        first = last;
+    } // while( first < end )
+
+    //! Run Jobs until the range is done.
+    wait( counter );
+} // Jobs::parallelFor()
+
+#endif // JOBS_H
@@ -0,0 +1,184 @@
+/*! \file latency.cpp
+\brief Latency class implementation file.
+This file contains the Latency class implementation for the application.
+*/
+
+// latency.h header file required for Latency class definition.
+#include "latency.h"
+
+// QTextStream header file required for reporting.
+#include <QTextStream>
+
+// algorithm header file required for sorting.
+#include <algorithm>
+
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The Latency execution begins here.
+//! Create the Latency and start the time stamp timer.
+//! Automatically called when the World is constructed.
+Latency::Latency()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Latency::Latency()...";
+
+    //! Start the time stamp timer.
+    mTimer.start();
+} // Latency::Latency()
+
+//! The Latency execution ends here.
+//! Automatically called when the World is destructed.
+Latency::~Latency()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Latency::~Latency()...";
+} // Latency::~Latency()
+
+//! Advance the samples waiting in one stage to the next stage.
+//! \param from is the stage to advance from.
+//! \param time is the time stamp of the stage completing.
+//! \return void
+void Latency::advance( Stage from, qint64 time )
+{
+    for( int i = 0; i < mPending.size(); i++ )
+    {
+        Sample & sample = mPending[i];
+
+        //! Skip samples in any other stage.
+        if( sample.stage != from )
+        {
+            continue;
+        }
+
+        //! Record the stage time and move on.
+        if( from == STAGE_ARRIVED )
+        {
+            sample.forced = time;
+            sample.stage  = STAGE_FORCED;
+            mForced.append( sample.forced - sample.arrived );
+        }
+        else
+        {
+            sample.moved = time;
+            sample.stage = STAGE_MOVED;
+            mMoved.append( sample.moved - sample.arrived );
+        }
+    } // for( int i = 0; i < mPending.size(); i++ )
+} // Latency::advance( Stage from, qint64 time )
+
+//! The Physics has applied the user force.
+//! \return void
+void Latency::forceApplied()
+{
+    if( mEnabled == false )
+    {
+        return;
+    }
+
+    advance( STAGE_ARRIVED, now() );
+} // Latency::forceApplied()
+
+//! A rendered frame has been swapped to the display.
+//! Completes every sample whose movement has been rendered.
+//! \return void
+void Latency::frameSwapped()
+{
+    if( mEnabled == false )
+    {
+        return;
+    }
+
+    qint64 time = now();
+
+    for( int i = mPending.size() - 1; i >= 0; i-- )
+    {
+        if( mPending[i].stage == STAGE_MOVED )
+        {
+            mSwapped.append( time - mPending[i].arrived );
+            mPending.remove( i );
+        }
+    } // for( int i = mPending.size() - 1; i >= 0; i-- )
+} // Latency::frameSwapped()
+
+//! An input event has been accepted by the Player.
+//! \param arrived is the time stamp taken when the event arrived.
+//! \return void
+void Latency::inputAccepted( qint64 arrived )
+{
+    if( mEnabled == false )
+    {
+        return;
+    }
+
+    //! Drop the oldest sample when too many are in flight, such as input while the Player is blocked.
+    if( mPending.size() >= MAXIMUM_PENDING )
+    {
+        mPending.remove( 0 );
+    }
+
+    Sample sample;
+    sample.stage   = STAGE_ARRIVED;
+    sample.arrived = arrived;
+    sample.forced  = 0;
+    sample.moved   = 0;
+    mPending.append( sample );
+} // Latency::inputAccepted( qint64 arrived )
+
+//! The Physics has moved the Player.
+//! \return void
+void Latency::positionChanged()
+{
+    if( mEnabled == false )
+    {
+        return;
+    }
+
+    advance( STAGE_FORCED, now() );
+} // Latency::positionChanged()
+
+//! Report the latency distribution of every stage.
+//! \return void
+void Latency::report()
+{
+    if( mEnabled == false )
+    {
+        return;
+    }
+
+    reportStage( "input to force applied", mForced );
+    reportStage( "input to player moved ", mMoved );
+    reportStage( "input to frame swapped", mSwapped );
+} // Latency::report()
+
+//! Report the distribution of one set of latencies.
+//! \param name is the stage name.
+//! \param latencies are the latencies in nanoseconds, sorted in place.
+//! \return void
+void Latency::reportStage( const char * name, QVector<qint64> & latencies )
+{
+    QTextStream out( stdout );
+
+    if( latencies.isEmpty() )
+    {
+        out << name << ": no samples" << endl;
+        return;
+    }
+
+    std::sort( latencies.begin(), latencies.end() );
+
+    //! Nearest rank percentile in milliseconds.
+    auto percentile = [ &latencies ]( int percent )
+    {
+        int rank = ( ( latencies.size() - 1 ) * percent + 50 ) / 100;
+        return QString::number( latencies[rank] / 1000000.0, 'f', 2 );
+    };
+
+    out << name << ": " << latencies.size() << " samples, mS"
+        << " min " << percentile( 0 )
+        << " median " << percentile( 50 )
+        << " p95 " << percentile( 95 )
+        << " p99 " << percentile( 99 )
+        << " max " << percentile( 100 ) << endl;
+} // Latency::reportStage( const char * name, QVector<qint64> & latencies )
@@ -0,0 +1,109 @@
+/*! \file latency.h
+\brief Latency class declaration file.
+This file contains the Latency class declaration for the application.
+*/
+
+#ifndef LATENCY_H
+#define LATENCY_H
+
+// QElapsedTimer header file required for time stamps.
+#include <QElapsedTimer>
+// QVector header file required for sample storage.
+#include <QVector>
+
+//! Latency class.
+/*!
+This class declaration encapsulates the input to display Latency measurement functionality.
+Every accepted key press is time stamped when it arrives and followed through the force
+being applied by the Physics, the first tick the Player position changes, and the buffer
+swap that displays it.
+*/
+class Latency
+{
+    //! Friend of World so that only World can instantiate the Latency.
+    friend class World;
+
+public: // Access Functions
+    //! Called to get/set the measurement enable.
+    bool & enabled() { return mEnabled; }
+
+public: // Member Functions
+    //! Called to get the current time stamp in nanoseconds.
+    qint64 now() const { return mTimer.nsecsElapsed(); }
+
+    //! Called when an input event has been accepted.
+    void inputAccepted( qint64 arrived );
+
+    //! Called when the Physics has applied the user force.
+    void forceApplied();
+
+    //! Called when the Physics has moved the Player.
+    void positionChanged();
+
+    //! Called when a rendered frame has been swapped to the display.
+    void frameSwapped();
+
+    //! Called to report the latency distribution.
+    void report();
+
+private: // Constructors / Destructors
+    //! Latency class constructor.
+    Latency();
+
+    //! Latency class destructor.
+    ~Latency();
+
+private: // Data Types
+    //! Internal stage of an input sample.
+    enum Stage
+    {
+        STAGE_ARRIVED, //!< - Waiting for the force to be applied.
+        STAGE_FORCED,  //!< - Waiting for the Player to move.
+        STAGE_MOVED    //!< - Waiting for the frame to be displayed.
+    }; // enum Stage
+
+    //! Internal input sample.
+    struct Sample
+    {
+        //! - Current stage of the sample.
+        Stage stage;
+        //! - Time the input arrived.
+        qint64 arrived;
+        //! - Time the force was applied.
+        qint64 forced;
+        //! - Time the Player moved.
+        qint64 moved;
+    }; // struct Sample
+
+private: // Member Variables
+    //! Used to store the measurement enable, initialized to false.
+    bool mEnabled = false;
+
+    //! Used to store the samples still in flight.
+    QVector<Sample> mPending;
+
+    //! Used to store the arrival to force applied latencies in nanoseconds.
+    QVector<qint64> mForced;
+
+    //! Used to store the arrival to Player moved latencies in nanoseconds.
+    QVector<qint64> mMoved;
+
+    //! Used to store the arrival to frame displayed latencies in nanoseconds.
+    QVector<qint64> mSwapped;
+
+    //! Used to time stamp the samples.
+    QElapsedTimer mTimer;
+
+private: // Data Constants
+    //! Maximum number of samples in flight, older samples are dropped.
+    const int MAXIMUM_PENDING = 256;
+
+private: // Helper Functions
+    //! Called to advance the samples in one stage to the next.
+    void advance( Stage from, qint64 time );
+
+    //! Called to report the distribution of one set of latencies.
+    void reportStage( const char * name, QVector<qint64> & latencies );
+}; // class Latency
+
+#endif // LATENCY_H
@@ -8,7 +8,26 @@ This file contains the Level class implementation for the application.
 
 // QFile header file required for opening Level file.
 #include <QFile>
-
+// QtConcurrent header file required for preparing the next Level on a worker thread.
+#include <QtConcurrent>
+
+// algorithm header file required for looking the Spans up.
+#include <algorithm>
+// cstring header file required for diffing the rows of a reloaded Level file.
+#include <cstring>
+
+// jobs.h header file required for computing the faces and culling in parallel.
+#include "jobs.h"
+// levelpack.h header file required for the Levels of the level pack.
+#include "levelpack.h"
+// levelparser.h header file required for parsing the text Level files.
+#include "levelparser.h"
+// memory.h header file required for counting the Level arrays.
+#include "memory.h"
+// settings.h header file required for the culling grain, the Camera reach and the chunk mode.
+#include "settings.h"
+// simulation.h header file required for forwarding the edits to the simulated Level.
+#include "simulation.h"
 // trace.h header file required for tracing execution.
 #include "trace.h"
 
@@ -30,21 +49,252 @@ Level::~Level()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Level::~Level()...";
 
+    //! Wait for a prefetch still running and release the Level data it prepared.
+    discard();
+
     //! Make sure to unload all Level resources.
     unload();
 } // Level::~Level()
 
-//! Check to see if there is a physical Cube at the position.
+//! Count the bytes of the Level Arena in the Memory of the Level arrays, replacing the
+//! bytes counted before, whenever the Arena is taken, grows or is released.
+//! \return void
+void Level::account()
+{
+    qint64 bytes = ( mpArena != NULL ) ? mpArena->reserved() : 0;
+
+    if( bytes == mAccountedBytes )
+    {
+        return;
+    } // if( bytes == mAccountedBytes )
+
+    if( mAccountedBytes != 0 )
+    {
+        Memory::freed( Memory::LEVEL_ARRAYS, mAccountedBytes );
+    } // if( mAccountedBytes != 0 )
+
+    if( bytes != 0 )
+    {
+        Memory::allocated( Memory::LEVEL_ARRAYS, bytes );
+    } // if( bytes != 0 )
+
+    mAccountedBytes = bytes;
+} // Level::account()
+
+//! Take ownership of prepared Level data, releasing the current Level data.
+//! \param prepared is the prepared Level data, emptied as it is taken.
+//! \return void
+void Level::adopt( Prepared & prepared )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::adopt( Prepared & prepared )...";
+
+    //! Take the prepared Level data, releasing the previous Level data with a reset of its Arena.
+    delete mpChunks;
+    Arena::recycle( mpArena );
+    mpArena        = prepared.pArena;
+    mpChunks       = prepared.pChunks;
+    mpCubeHeight   = prepared.pCubeHeight;
+    mpCubeType     = prepared.pCubeType;
+    mpCubeFaces    = prepared.pCubeFaces;
+    mpCubeSupport  = prepared.pCubeSupport;
+    mpSpans        = prepared.pSpans;
+    mSpanCount     = prepared.spanCount;
+    mCubeColumns   = prepared.cubeColumns;
+    mCubeRows      = prepared.cubeRows;
+    mCubeCount     = prepared.cubeCount;
+    mStartPosition = prepared.startPosition;
+    mLoadError     = prepared.error;
+    mSourceFile    = prepared.file;
+    mViews         = prepared.views;
+    mpVisible      = NULL;
+    mpWindowHeight = NULL;
+    mpWindowType   = NULL;
+    mpWindowFaces  = NULL;
+
+    //! Cut the culling results, and the render window of a chunked Level, out of the Arena
+    //! prepare() sized for them.
+    if( mpArena != NULL )
+    {
+        uint count = renderCount( mCubeColumns, mCubeRows, mpChunks != NULL );
+
+        mpVisible = mpArena->allocate< bool >( count );
+
+        if( mpChunks != NULL )
+        {
+            mpWindowHeight = mpArena->allocate< quint8 >( count );
+            mpWindowType   = mpArena->allocate< quint8 >( count );
+            mpWindowFaces  = mpArena->allocate< quint8 >( count );
+        } // if( mpChunks != NULL )
+    } // if( mpArena != NULL )
+
+    //! The prepared Level data is now owned by the Level.
+    prepared.pArena  = NULL;
+    prepared.pChunks = NULL;
+    release( prepared );
+
+    //! The Cubes changed, the last support classification is stale and no edit is left to apply.
+    mGeneration++;
+    mSupportCached = false;
+    mDirtyFirstX   = ~0u;
+    mDirtyFirstZ   = ~0u;
+    mDirtyLastX    = 0;
+    mDirtyLastZ    = 0;
+
+    account();
+} // Level::adopt( Prepared & prepared )
+
+//! Start a batch of cell edits, the faces and the support around the edited cells are only
+//! updated once, when the batch ends. Batches nest, the outermost endEdit() applies them.
+//! \return void
+//! \sa endEdit, setCubeHeight, setCubeType
+void Level::beginEdit()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::beginEdit()...";
+
+    mEditDepth++;
+} // Level::beginEdit()
+
+//! Classify the Cubes that can support the Player in a cell, the Cube of the cell and its
+//! eight neighbours with their top on the plane the Player is on.
+//! \param x is the column of the cell.
+//! \param y is the height of the Cubes that can support the Player, one below its plane.
+//! \param z is the row of the cell.
+//! \return uint is the Support bits of the Cubes at that height.
+uint Level::classifySupport( int x, int y, int z )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::classifySupport( int x, int y, int z )...";
+
+    uint support = 0;
+
+    if( cubeAtPosition( x,     y, z     ) ) { support |= SUPPORT_CENTRE;     }
+    if( cubeAtPosition( x - 1, y, z     ) ) { support |= SUPPORT_LEFT;       }
+    if( cubeAtPosition( x + 1, y, z     ) ) { support |= SUPPORT_RIGHT;      }
+    if( cubeAtPosition( x,     y, z - 1 ) ) { support |= SUPPORT_FAR;        }
+    if( cubeAtPosition( x,     y, z + 1 ) ) { support |= SUPPORT_NEAR;       }
+    if( cubeAtPosition( x - 1, y, z - 1 ) ) { support |= SUPPORT_FAR_LEFT;   }
+    if( cubeAtPosition( x + 1, y, z - 1 ) ) { support |= SUPPORT_FAR_RIGHT;  }
+    if( cubeAtPosition( x - 1, y, z + 1 ) ) { support |= SUPPORT_NEAR_LEFT;  }
+    if( cubeAtPosition( x + 1, y, z + 1 ) ) { support |= SUPPORT_NEAR_RIGHT; }
+
+    return support;
+} // Level::classifySupport( int x, int y, int z )
+
+//! Compute the visible faces of a rectangle of cells from the heights of their neighbours.
+//! The rows are spread over the Jobs workers as each row only writes its own cells.
+//! \param pHeight is the height of the Cube of every cell.
+//! \param pType is the CubeType of every cell.
+//! \param pFaces is the mask of the visible faces of every cell, written within the rectangle.
+//! \param columns is the number of Cube columns in the Level.
+//! \param rows is the number of Cube rows in the Level.
+//! \param firstX is the first column of the rectangle.
+//! \param firstZ is the first row of the rectangle.
+//! \param lastX is the column past the rectangle.
+//! \param lastZ is the row past the rectangle.
+//! \return void
+void Level::computeFaces( const quint8 * pHeight, const quint8 * pType, quint8 * pFaces,
+                          uint columns, uint rows, uint firstX, uint firstZ, uint lastX, uint lastZ )
+{
+    //! Loop through the rectangle by row.
+    Jobs::instance().parallelFor( firstZ, lastZ, 0, [ pHeight, pType, pFaces, columns, rows, firstX, lastX ]( uint z )
+    {
+        //! A Hole or the Level edge covers no face of its neighbours.
+        auto neighbour = [ pHeight, pType ]( uint i ) -> int
+        {
+            return ( pType[ i ] == Cube::CubeType::HOLE ) ? -1 : pHeight[ i ];
+        };
+
+        //! Loop through the Cubes in the row.
+        for( uint x = firstX; x < lastX; x++ )
+        {
+            uint i = x + z * columns;
+
+            int far   = ( z == 0 )               ? -1 : neighbour( i - columns );
+            int near  = ( z == ( rows - 1 ) )    ? -1 : neighbour( i + columns );
+            int left  = ( x == 0 )               ? -1 : neighbour( i - 1 );
+            int right = ( x == ( columns - 1 ) ) ? -1 : neighbour( i + 1 );
+
+            //! Set the Cube Face visibility from its neighbours.
+            pFaces[ i ] = Cube::visibleFaces( pType[ i ], pHeight[ i ], far, near, left, right );
+        } // for( uint x = firstX; x < lastX; x++ )
+    } ); // Jobs::instance().parallelFor( firstZ, lastZ, 0, ... )
+} // Level::computeFaces()
+
+//! Classify the Cubes that can support the Player in a rectangle of cells, on the plane of
+//! the Cube of each cell. A Hole is left without support, the Player over it is classified
+//! when it enters the cell. The rows are spread over the Jobs workers as for the faces.
+//! \param pHeight is the height of the Cube of every cell.
+//! \param pType is the CubeType of every cell.
+//! \param pSpans is the Spans sorted by cell, NULL when there are none.
+//! \param spanCount is the number of Spans.
+//! \param pSupport is the Support bits of every cell, written within the rectangle.
+//! \param columns is the number of Cube columns in the Level.
+//! \param rows is the number of Cube rows in the Level.
+//! \param firstX is the first column of the rectangle.
+//! \param firstZ is the first row of the rectangle.
+//! \param lastX is the column past the rectangle.
+//! \param lastZ is the row past the rectangle.
+//! \return void
+//! \sa classifySupport
+void Level::computeSupport( const quint8 * pHeight, const quint8 * pType, const Cube::Span * pSpans, uint spanCount,
+                            quint16 * pSupport, uint columns, uint rows, uint firstX, uint firstZ, uint lastX, uint lastZ )
+{
+    //! Loop through the rectangle by row.
+    Jobs::instance().parallelFor( firstZ, lastZ, 0, [ pHeight, pType, pSpans, spanCount, pSupport, columns, rows, firstX, lastX ]( uint z )
+    {
+        //! A cell supports on a plane if its Cube, or a Cube of its Spans, has its top there.
+        auto cubeAt = [ pHeight, pType, pSpans, spanCount, columns, rows ]( int x, int y, int z ) -> bool
+        {
+            if( x < 0 || z < 0 || (uint)x >= columns || (uint)z >= rows )
+            {
+                return false;
+            } // if( x < 0 || z < 0 || ... )
+
+            uint i = x + z * columns;
+
+            return ( pType[ i ] != Cube::HOLE && pHeight[ i ] == y ) ||
+                   ( spanCount != 0 && spanAtHeight( pSpans, spanCount, i, y ) != NULL );
+        };
+
+        //! Loop through the Cubes in the row.
+        for( uint x = firstX; x < lastX; x++ )
+        {
+            uint i = x + z * columns;
+            uint support = 0;
+
+            if( pType[ i ] != Cube::HOLE )
+            {
+                int cx = x;
+                int cy = pHeight[ i ];
+                int cz = z;
+
+                support = SUPPORT_CENTRE;
+
+                if( cubeAt( cx - 1, cy, cz     ) ) { support |= SUPPORT_LEFT;       }
+                if( cubeAt( cx + 1, cy, cz     ) ) { support |= SUPPORT_RIGHT;      }
+                if( cubeAt( cx,     cy, cz - 1 ) ) { support |= SUPPORT_FAR;        }
+                if( cubeAt( cx,     cy, cz + 1 ) ) { support |= SUPPORT_NEAR;       }
+                if( cubeAt( cx - 1, cy, cz - 1 ) ) { support |= SUPPORT_FAR_LEFT;   }
+                if( cubeAt( cx + 1, cy, cz - 1 ) ) { support |= SUPPORT_FAR_RIGHT;  }
+                if( cubeAt( cx - 1, cy, cz + 1 ) ) { support |= SUPPORT_NEAR_LEFT;  }
+                if( cubeAt( cx + 1, cy, cz + 1 ) ) { support |= SUPPORT_NEAR_RIGHT; }
+            } // if( pType[ i ] != Cube::HOLE )
+
+            pSupport[ i ] = support;
+        } // for( uint x = firstX; x < lastX; x++ )
+    } ); // Jobs::instance().parallelFor( firstZ, lastZ, 0, ... )
+} // Level::computeSupport()
+
+//! Check to see if there is a physical Cube at the position, the Cube of the cell or a Cube of its Spans.
 //! \note Cube of type Hole are not considered a physical Cube.
 //! \return bool is true if there is a physical Cube at the position.
 bool Level::cubeAtPosition( int x, int y, int z )
 {
-    //! If Cube array is not loaded.
-    if( mpCube == NULL )
+    //! If the Level data is not loaded.
+    if( mCubeCount == 0 )
     {
         //! -Return false no Cube at the position.
         return false;
-    } // if( mpCube == NULL )
+    } // if( mCubeCount == 0 )
 
     //! If either of the horizontal position values is negative.
     if( x < 0 || z < 0 )
@@ -54,29 +304,37 @@ bool Level::cubeAtPosition( int x, int y, int z )
     } // if( x < 0 || z < 0 )
 
     //! If either of the horizontal position values is out of range.
-    if( (uint)x >= mCubeCols || (uint)z > mCubeRows )
+    if( (uint)x >= mCubeColumns || (uint)z >= mCubeRows )
     {
         //! -Return false no Cubes exists in the out of range region.
         return false;
-    } // if( x >= mCubeCols || z > mCubeRows )
+    } // if( x >= mCubeColumns || z >= mCubeRows )
 
-    //! If the Cube at that position is of type Hole.
-    if( mpCube[ x + z * mCubeCols ].mType == Cube::HOLE )
+    //! If the Cube of the cell is not a Hole and is at the Y specified.
+    if( cellType( x, z ) != Cube::HOLE && cellHeight( x, z ) == y )
     {
-        //! -Return false effectively no physical Cube exists at that position.
-        return false;
-    } // if( mpCube[ x + z * mCubeCols ].mType == Cube::HOLE )
+        //! -Return true there is a cube at the position.
+        return true;
+    } // if( cellType( x, z ) != Cube::HOLE && cellHeight( x, z ) == y )
+
+    //! Else there is a cube at the position if a Span of the cell holds one, above a Hole too.
+    return ( mSpanCount != 0 ) && ( spanAtHeight( mpSpans, mSpanCount, x + z * mCubeColumns, y ) != NULL );
+} // Level::cubeAtPosition( int x, int y, int z )
 
-    //! If the Y value of the Cube is different then the Y specified.
-    if( mpCube[ x + z * mCubeCols ].mPosition.y() != y )
+//! Lookup the height of the Cube at the specified location.
+//! \param column is the X position in the Level.
+//! \param row is the Z position in the Level.
+//! \return int is the height of the Cube, zero outside the Level.
+int Level::cubeHeight( uint column, uint row )
+{
+    if( ( column >= mCubeColumns ) || (row >= mCubeRows) )
     {
-        //! -Return false the cube is at a different height.
-        return false;
-    } // if( mpCube[ x + z * mCubeCols ].mPosition.y() != y )
+        return 0;
+    }
 
-    //! Return true there is a cube at the position.
-    return true;
-} // Level::cubeAtPosition( int x, int y, int z )
+    //! Return the Cube height at the location.
+    return cellHeight( column, row );
+} // Level::cubeHeight( uint column, uint row )
 
 //! Lookup what type of Cube is at the specified location.
 //! \param column is the X position in the Level.
@@ -86,15 +344,130 @@ Cube::CubeType Level::cubeType( uint column, uint row )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Level::cubeType( uint column, uint row )...";
 
-    if( ( column >= mCubeCols ) || (row >= mCubeRows) )
+    if( ( column >= mCubeColumns ) || (row >= mCubeRows) )
     {
         return Cube::CubeType::HOLE;
     }
 
     //! Return the CubeType at the location.
-    return mpCube[ row * mCubeCols + column ].mType;
+    return (Cube::CubeType)cellType( column, row );
 } // Level::cubeType( uint column, uint row )
 
+//! Lookup the type of the physical Cube at the position, the Cube of the cell or a Cube of its Spans.
+//! A Span above a cell supports the Player with its own type, not the type of the cell below.
+//! \param x is the X position in the Level.
+//! \param y is the height of the Cube.
+//! \param z is the Z position in the Level.
+//! \return CubeType is the type of the Cube, Hole when there is no physical Cube at the position.
+Cube::CubeType Level::cubeTypeAt( int x, int y, int z )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::cubeTypeAt( int x, int y, int z )...";
+
+    //! If the Level data is not loaded or the position is out of the Level.
+    if( mCubeCount == 0 || x < 0 || z < 0 || (uint)x >= mCubeColumns || (uint)z >= mCubeRows )
+    {
+        //! -Return Hole no Cubes exists out of the Level.
+        return Cube::CubeType::HOLE;
+    } // if( mCubeCount == 0 || x < 0 || z < 0 || ... )
+
+    //! If the Cube of the cell is a physical Cube at the Y specified, return its type.
+    if( cellHeight( x, z ) == y && cellType( x, z ) != Cube::HOLE )
+    {
+        return (Cube::CubeType)cellType( x, z );
+    } // if( cellHeight( x, z ) == y && cellType( x, z ) != Cube::HOLE )
+
+    //! Else return the type of the Span of the cell holding a Cube at the Y specified.
+    const Cube::Span * pSpan = ( mSpanCount != 0 ) ? spanAtHeight( mpSpans, mSpanCount, x + z * mCubeColumns, y ) : NULL;
+
+    return ( pSpan != NULL ) ? (Cube::CubeType)pSpan->type : Cube::CubeType::HOLE;
+} // Level::cubeTypeAt( int x, int y, int z )
+
+//! Grow the rectangle of the edited cells, and apply the edits unless a batch is open.
+//! \param column is the X position of the edited cell.
+//! \param row is the Z position of the edited cell.
+//! \return void
+void Level::dirty( uint column, uint row )
+{
+    mDirtyFirstX = qMin( mDirtyFirstX, column );
+    mDirtyFirstZ = qMin( mDirtyFirstZ, row );
+    mDirtyLastX  = qMax( mDirtyLastX, column );
+    mDirtyLastZ  = qMax( mDirtyLastZ, row );
+
+    if( mEditDepth == 0 )
+    {
+        rebuild();
+    } // if( mEditDepth == 0 )
+} // Level::dirty( uint column, uint row )
+
+//! Wait for a prefetch still running and release the Level data it prepared.
+//! \return void
+void Level::discard()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::discard()...";
+
+    //! If a prefetch was started and not taken.
+    if( mPrefetching == true )
+    {
+        //! Wait for the prefetch to finish and release its Level data.
+        Prepared prepared = mPrefetch.result();
+        release( prepared );
+        mPrefetching = false;
+    } // if( mPrefetching == true )
+} // Level::discard()
+
+//! Make a cell ready to edit. The cells of a level pack Level are views into the mapped
+//! pack, they are copied into the Level Arena on the first edit.
+//! \param column is the X position of the cell.
+//! \param row is the Z position of the cell.
+//! \return bool is false when the cell is outside the Level, or the Level is chunked, its
+//! chunks are read only.
+bool Level::editable( uint column, uint row )
+{
+    if( mCubeCount == 0 || mpChunks != NULL || column >= mCubeColumns || row >= mCubeRows )
+    {
+        return false;
+    } // if( mCubeCount == 0 || mpChunks != NULL || ... )
+
+    if( mViews == true )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "Level::editable() - copying the level pack views...";
+
+        quint8 * pHeight = mpArena->allocate< quint8 >( mCubeCount );
+        quint8 * pType   = mpArena->allocate< quint8 >( mCubeCount );
+        quint8 * pFaces  = mpArena->allocate< quint8 >( mCubeCount );
+        memcpy( pHeight, mpCubeHeight, mCubeCount );
+        memcpy( pType, mpCubeType, mCubeCount );
+        memcpy( pFaces, mpCubeFaces, mCubeCount );
+        mpCubeHeight = pHeight;
+        mpCubeType   = pType;
+        mpCubeFaces  = pFaces;
+        mViews       = false;
+
+        account();
+    } // if( mViews == true )
+
+    return true;
+} // Level::editable( uint column, uint row )
+
+//! End a batch of cell edits, when it is the outermost apply them.
+//! \return void
+//! \sa beginEdit
+void Level::endEdit()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::endEdit()...";
+
+    if( mEditDepth > 0 && --mEditDepth == 0 )
+    {
+        rebuild();
+
+        //! The simulated Level applies the forwarded batch as a whole too.
+        if( mpSimulation != NULL )
+        {
+            mpSimulation->endEdit();
+        } // if( mpSimulation != NULL )
+    } // if( mEditDepth > 0 && --mEditDepth == 0 )
+} // Level::endEdit()
+
 //! Check to see if the position is inside Level.
 //! \param position is value to check if it is inside the Level.
 //! \return bool is true if position is with in the limits of the Level.
@@ -104,351 +477,168 @@ bool Level::insideLevel( const QVector3D & position )
     if( position.y() >= -0.5f )
     {
         //! -If position X is inside the Level.
-        if( position.x() >= -0.5f && position.x() <= (mCubeCols + 0.5) )
+        if( position.x() >= -0.5f && position.x() <= (mCubeColumns + 0.5) )
         {
             //! --If the position Z is inside the Level.
-            if( position.x() >= -0.5f && position.x() <= (mCubeCols + 0.5) )
+            if( position.x() >= -0.5f && position.x() <= (mCubeColumns + 0.5) )
             {
                 //! ---Return true position is inside the Level.
                 return true;
-            } // if( position.x() >= -0.5f && position.x() <= (mCubeCols + 0.5) )
-        } // if( position.x() >= -0.5f && position.x() <= (mCubeCols + 0.5) )
+            } // if( position.x() >= -0.5f && position.x() <= (mCubeColumns + 0.5) )
+        } // if( position.x() >= -0.5f && position.x() <= (mCubeColumns + 0.5) )
     } // if( position.y() >= -0.5f )
 
     //! Return false the position is outside the Level.
     return false;
 } // Level::insideLevelCube( const QVector3D & position )
 
-//! Load the Opengl resources for the Level.
+//! Load the Level data and the Level OpenGL resources.
+//! The Level data is prepared off the render thread when it was prefetched, only the
+//! short OpenGL upload runs here.
 //! \return void
 void Level::load()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Level::load()...";
 
-    //! Create Level file name with Level index.
-    QString name(":Level" + QString::number(mLevelIndex) );
-
-    //! Create a file handle.
-    QFile file( name );
-
-    //! Verify the level file exists.
-    if( file.exists() == false )
+    //! Load the Level data, if it fails report why and return without loading the OpenGL resources.
+    if( loadData() == false )
     {
-        TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - File does NOT exists - " << name <<"...";
-        //! If it does not exists return without loading Level.
+        QTextStream( stderr ) << mLoadError << endl;
         return;
-    } // if( file.exists() == false )
+    } // if( loadData() == false )
 
-    //! Open the file for reading.
-    if( file.open( QIODevice::ReadOnly ) == false )
-    {
-        TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Unable to open Level file...";
-        //! If it fails to open return without loading Level.
-        return;
-    } // if( file.open( QIODevice::ReadOnly ) == false )
+    //! Load the Cube openGL resources.
+    Cube::load();
+} // Level::load()
 
-    //! Create a text stream for the file parsing.
-    QTextStream textStream(&file);
+//! Load the Level data for the current Level index.
+//! The prefetched Level data is taken when it was prepared for the current Level index,
+//! else the Level data is prepared now. No OpenGL resources are touched so the Physics
+//! can run without a context.
+//! \return bool is true on success.
+bool Level::loadData()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::loadData()...";
 
-    //! Create a string list to load the rows of level text.
-    QStringList levelRowStringList;
+    Prepared prepared;
 
-    //! Loop through the file.
-    while (true)
+    //! If the current Level was prefetched.
+    if( mPrefetching == true && mPrefetchIndex == mLevelIndex && mPrefetchFile == mLevelFile )
     {
-        //! Read a line from the file.
-        QString line = textStream.readLine();
-        //! Check the line read to see if it is the end of file.
-        if (line.isNull())
-        {
-            //! If it is the end of file stop looping through file.
-            break;
-        } // if (line.isNull())
-        else
-        {
-            //! If it is not the end of the file append the row to the list of row string.
-            levelRowStringList.append(line);
-        } // if (line.isNull()) else
-    } // while (true)
+        //! Take the prefetched Level data, waiting if the worker thread is still preparing it.
+        prepared = mPrefetch.result();
+        mPrefetching = false;
+    } // if( mPrefetching == true && ... )
+    //! Else prepare the Level data now.
+    else
+    {
+        //! A prefetch of another Level will not be used.
+        discard();
+        prepared = prepare( mLevelIndex, mLevelFile );
+    } // if( mPrefetching == true && ... ) else
 
-    //! The file is loaded into memory.
-    //! Close the file.
-    file.close();
+    //! Replace the current Level data.
+    adopt( prepared );
 
-    //! Unpack the rows into cubes.
-    QVector<QStringList> cubeData;
-    foreach (QString string, levelRowStringList)
-    {
-        QStringList rowData = string.split(",");
-        cubeData << rowData;
-    } // foreach (QString string, levelRowStringList)
+    //! Level data loaded successfully when there are Cubes.
+    return ( mCubeCount != 0 );
+} // Level::loadData()
 
-    //! Determine how many cubes are in the level.
-    mCubeRows  = cubeData[0].length();
-    mCubeCols  = cubeData.length();
-    mCubeCount = mCubeRows * mCubeCols;
+//! Check to see if the Player is directly on top of a physical Cube.
+//! The Cubes that can support the Player on the plane of the Cube of its cell are read from
+//! the support bits classified with the cell arrays. Over a Hole, on a Span or another plane,
+//! and in a chunked Level, they are classified when it enters a cell or changes plane. The
+//! queries only test the edges it is on.
+//! \param position is the Player position.
+//! \return bool is true if player is on a Cube.
+//! \sa playerOnACubeSearch
+bool Level::playerOnACube( const QVector3D & position )
+{
+    //! Calculate the center of the Cube the position would be in.
+    int cubeX = qRound( position.x() );
+    int cubeY = qRound( position.y() );
+    int cubeZ = qRound( position.z() );
 
-    //! Attempt to allocat the cubes for the level
-    if( (mpCube = new Cube[mCubeCount]) == NULL)
+    //! If the Player is out of the Level.
+    if( insideLevel( QVector3D( cubeX, cubeY, cubeZ ) ) == false )
     {
-        TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Unable to allocate memory for the Cube array...";
-        //! If it fails to allocate memory return without loading Level.
-        return;
-    } // if( (mpCube = new Cube[mCubeCount]) == NULL)
+        //! -Return false player is outside Level.
+        return false;
+    } // if( insideLevel( QVector3D( cubeX, cubeY, cubeZ ) ) == false )
 
-    //! Load the Cube openGL resources.
-    Cube::load();
+    //! If the Player is NOT on a plane.
+    if( playerOnPlane( position ) == false )
+    {
+        //! -Return false Player is not on a plane.
+        return false;
+    } // if( playerOnPlane( position ) == false )
 
-    //! Configure the cubes
+    //! The Cubes that can support the Player.
+    uint support = 0;
+    uint cell    = cubeX + cubeZ * mCubeColumns;
 
-    //! Go through the rows of Cube.
-    uint z = 0;
-    foreach (QStringList sl, cubeData)
+    //! If the Player is on the plane of the Cube of its cell, its support was classified with the Level.
+    if( mpCubeSupport != NULL && cubeX >= 0 && cubeZ >= 0 && (uint)cubeX < mCubeColumns && (uint)cubeZ < mCubeRows &&
+        mpCubeType[ cell ] != Cube::HOLE && mpCubeHeight[ cell ] == cubeY - 1 )
+    {
+        support = mpCubeSupport[ cell ];
+    } // if( mpCubeSupport != NULL && ... )
+    //! Else over a Hole, on a Span or another plane, or in a chunked Level.
+    else
     {
-        //! Go through each Cube in the row.
-        uint x=0;
-        foreach (QString s, sl)
+        //! -If the Player is not in the last classified cell and plane, classify the new one.
+        if( mSupportCached == false || cubeX != mSupportX || cubeY != mSupportY || cubeZ != mSupportZ )
         {
-            //! Parse out the Type and height of the Cube.
-            QStringList vals = s.split(":");
+            mSupport       = classifySupport( cubeX, ( cubeY - 1 ), cubeZ );
+            mSupportX      = cubeX;
+            mSupportY      = cubeY;
+            mSupportZ      = cubeZ;
+            mSupportCached = true;
+        } // if( mSupportCached == false || ... )
 
-            //! Verify that the parse found 2 parts the Type and height.
-            if( vals.length() != 2 )
-            {
-                TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Parse Type and Height Failed.- Level file corrupt...";
-                //! If parse failed Assert to alert of issue.
-                Q_ASSERT_X( false, "Parse Type and Height Failed.", "Level File Corrupted." );
-                //! Return without loading Level.
-                return;
-            } // if( vals.length() == 2 )
-
-            //! Validate the Type and Height conversion from base 16 string to base 10 unsigned int.
-            bool ok;
-            uint type = vals[0].toInt(&ok,16);
-            if( ok == false )
-            {
-                TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Convert Type String Failed...";
-                //! If convert failed Assert to alert of issue.
-                Q_ASSERT_X( false, "Convert Type Failed.", "Level File Corrupted." );
-                //! Return without loading Level.
-                return;
-            } // if( ok == false )
-
-            uint height  = vals[1].toInt(&ok,16);
-            if( ok == false )
-            {
-                TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Convert Height String Failed...";
-                //! If convert failed Assert to alert of issue.
-                Q_ASSERT_X( false, "Convert Height Failed.", "Level File Corrupted." );
-                //! Return without loading Level.
-                return;
-            } // if( ok == false )
-
-            //! Set the Cube Position.
-            mpCube[z*sl.length()+x].mPosition = QVector3D(x,height,z);
-            //! Set the Cube Type.
-            mpCube[z*sl.length()+x].mType = (Cube::CubeType)type;
-
-            //! Check to see if the Cube is the Start position.
-            if( type == Cube::START)
-            {
-                //! If it is the Start position, store that location.
-                mStartPosition = QVector3D(x,height+1,z);
-            } // if( type == Cube::START)
-            x++; // Incrment the column index.
-        } // oreach (QString s, sl)
-        z++;  // Incrment the row index.
-    } // foreach (QStringList sl, cubeData)
+        support = mSupport;
+    } // if( mpCubeSupport != NULL && ... ) else
 
-    //! Turn off hidden faces. Face that can never be seen such as between adjacent Cubes.
+    //! If there is a cube directly below the Player position.
+    if( ( support & SUPPORT_CENTRE ) != 0 )
+    {
+        //! -Return true the player is on the plane and there is a cube directly below.
+        return true;
+    } // if( ( support & SUPPORT_CENTRE ) != 0 )
 
-    //! Loop through the Level by row.
-    for(z=0; z<mCubeRows; z++)
+    //! If no neighbour can support the Player, the edges it is on do not matter.
+    if( support == 0 )
     {
-        //! Loop through the Cubes in the row.
-        for(uint x=0; x<mCubeCols; x++)
-        {
-            //! Track Which faces can be seen.
-            //! Assume that the Top face is always visible and all other are not until proven otherwise.
-            bool top    = true;
-            bool bottom = false;
-            bool left   = false;
-            bool right  = false;
-            bool front  = false;
-            bool back   = false;
-
-            //! If the cube is a Hole type.
-            if( mpCube[x + z * mCubeCols].mType == Cube::CubeType::HOLE )
-            {
-                //! All faces are invisible.
-                top = false;
-            } // if( mpCube[x + z * mCubeCols].mType == Cube::CubeType::HOLE )
-            //! Determine what faces could be visible.
-            else
-            {
-                //! If the cube is on the back row.
-                if( z == 0 )
-                {
-                    //! -Then the back face is visible.
-                    back = true;
-
-                    //! -If it is at a different height  then the Cube in fornt of it.
-                    if( mpCube[x + z * mCubeCols].mPosition.y() != mpCube[x + (z + 1) * mCubeCols].mPosition.y() )
-                    {
-                        //! --Then the front face is visible.
-                        front = true;
-                    } // if( mpCube[x + z * mCubeCols].mPosition.y() > mpCube[x + (z + 1) * mCubeCols].mPosition.y() )
-                    //! -If the Cube in front is a Hole type.
-                    else if( mpCube[x + (z + 1) * mCubeCols].mType == Cube::CubeType::HOLE )
-                    {
-                        //! --Then the front face is visible.
-                        front = true;
-                    } // else if( mpCube[x + (z + 1) * mCubeCols].mType == Cube::CubeType::HOLE )
-                } // if( z == 0 )
-                //! If the cube is on the front row.
-                else if( z == (mCubeRows - 1) )
-                {
-                    //! -Then the front face is visible.
-                    front = true;
-
-                    //! -If it is at a different height then the Cube in behind it.
-                    if( mpCube[x + z * mCubeCols].mPosition.y() != mpCube[x + (z - 1) * mCubeCols].mPosition.y() )
-                    {
-                        //! --Then the back face is visible.
-                        back = true;
-                    } // if( mpCube[x + z * mCubeCols].mPosition.y() > mpCube[x + (z - 1) * mCubeCols].mPosition.y() )
-                    //! -If the Cube in behind is a Hole type.
-                    else if( mpCube[x + (z - 1) * mCubeCols].mType == Cube::CubeType::HOLE )
-                    {
-                        //! --Then the back face is visible.
-                        back = true;
-                    } // else if( mpCube[x + (z - 1) * mCubeCols].mType == Cube::CubeType::HOLE )
-                } // else if( z == (mCubeRows - 1) )
-                //! Else the Cube is not on the front or back edge of the Level.
-                else
-                {
-                    //! -If it is at a different height  then the Cube in behind it.
-                    if( mpCube[x + z * mCubeCols].mPosition.y() != mpCube[x + (z - 1) * mCubeCols].mPosition.y() )
-                    {
-                        //! --Then the back face is visible.
-                        back = true;
-                    } // if( mpCube[x + z * mCubeCols].mPosition.y() > mpCube[x + (z - 1) * mCubeCols].mPosition.y() )
-
-                    //! -If it is at a different height  then the Cube in front of it.
-                    if( mpCube[x + z * mCubeCols].mPosition.y() != mpCube[x + (z + 1) * mCubeCols].mPosition.y() )
-                    {
-                        //! --Then the front face is visible.
-                        front = true;
-                    } // if( mpCube[x + z * mCubeCols].mPosition.y() > mpCube[x + (z + 1) * mCubeCols].mPosition.y() )
-
-                    //! -If the Cube behind is a HOLE cube..
-                    if( mpCube[x + (z - 1) * mCubeCols].mType == Cube::HOLE)
-                    {
-                        //! --Then the back face is visible.
-                        back = true;
-                    } // if( mpCube[x + (z - 1) * mCubeCols].type() == Cube::HOLE)
-
-                    //! -If the Cube in front is a HOLE cube..
-                    if( mpCube[x + (z + 1) * mCubeCols].mType == Cube::HOLE)
-                    {
-                        //! --Then the front face is visible.
-                        front = true;
-                    } // if( mpCube[x + (z + 1) * mCubeCols].type() == Cube::HOLE)
-                } // if( z == 0 ) else if( z == (mCubeRows - 1) ) else
-
-                //! If the cube is on the left row.
-                if( x == 0 )
-                {
-                    //! -Then the left face is visible.
-                    left = true;
-
-                    //! -If it is at a different height  then the Cube to the right of it.
-                    if( mpCube[x + z * mCubeCols].mPosition.y() != mpCube[(x + 1) + z * mCubeCols].mPosition.y() )
-                    {
-                        //! --Then the right face is visible.
-                        right = true;
-                    } // if( mpCube[x + z * mCubeCols].mPosition.y() > mpCube[(x + 1) + z * mCubeCols].mPosition.y() )
-                    //! -If the Cube to the right is a Hole type.
-                    else if( mpCube[(x + 1) + z * mCubeCols].mType == Cube::CubeType::HOLE )
-                    {
-                        //! --Then the right face is visible.
-                        right = true;
-                    } // else if( mpCube[(x + 1) + z * mCubeCols].mType == Cube::CubeType::HOLE )
-                } // if( x == 0 )
-                //! If the cube is on the right row.
-                else if( x == (mCubeCols - 1) )
-                {
-                    //! -Then the right face is visible.
-                    right = true;
-
-                    //! -If it is at a different height  then the Cube to the left of it.
-                    if( mpCube[x + z * mCubeCols].mPosition.y() != mpCube[(x - 1) + z * mCubeCols].mPosition.y() )
-                    {
-                        //! --Then the LEFT face is visible.
-                        left = true;
-                    } // if( mpCube[x + z * mCubeCols].mPosition.y() > mpCube[(x - 1) + z * mCubeCols].mPosition.y() )
-                    //! -If the Cube to the left is a Hole type.
-                    else if( mpCube[(x - 1) + z * mCubeCols].mType == Cube::CubeType::HOLE )
-                    {
-                        //! --Then the left face is visible.
-                        left = true;
-                    } // else if( mpCube[(x - 1) + z * mCubeCols].mType == Cube::CubeType::HOLE )
-                } // else if( x == (mCubeCols - 1) )
-                //! Else the Cube is not on the left or right edge of the Level.
-                else
-                {
-                    //! -If it is at a different height then the Cube to the left it.
-                    if( mpCube[x + z * mCubeCols].mPosition.y() != mpCube[(x - 1) + z * mCubeCols].mPosition.y() )
-                    {
-                        //! --Then the left face is visible.
-                        left = true;
-                    } // if( mpCube[x + z * mCubeCols].mPosition.y() > mpCube[(x - 1) + z * mCubeCols].mPosition.y() )
-
-                    //! -If it is at a different height then the Cube to the right it.
-                    if( mpCube[x + z * mCubeCols].mPosition.y() != mpCube[(x + 1) + z * mCubeCols].mPosition.y() )
-                    {
-                        //! --Then the right face is visible.
-                        right = true;
-                    } // if( mpCube[x + z * mCubeCols].mPosition.y() > mpCube[(x + 1) + z * mCubeCols].mPosition.y() )
-
-                    //! -If the Cube to the left is a HOLE Cube.
-                    if( mpCube[(x - 1) + z * mCubeCols].mType == Cube::HOLE)
-                    {
-                        //! --Then the left face is visible.
-                        left = true;
-                    } // if( mpCube[(x - 1) + z * mCubeCols].type() == Cube::HOLE)
-
-                    //! -If the Cube to the right is a HOLE Cube.
-                    if( mpCube[(x + 1) + z * mCubeCols].mType == Cube::HOLE)
-                    {
-                        //! --Then the right face is visible.
-                        right = true;
-                    } // if( mpCube[(x + 1) + z * mCubeCols].type() == Cube::HOLE)
-                } // if( x == 0 ) else if( x == (mCubeCols - 1) ) else
-
-                //! If the Cube is higher then 1.
-                if( mpCube[x + z * mCubeCols].mPosition.y() > 1 )
-                {
-                    //! Assume the bottom is visible.
-                    bottom = true;
-                } // if( mpCube[x + z * mCubeCols].mPosition.y() > 1 )
-            }
-
-            //! Set the Cube Face visibility as has been determined.
-            mpCube[x + z * mCubeCols].mFace[ Cube::CubeFace::TOP    ] = top;
-            mpCube[x + z * mCubeCols].mFace[ Cube::CubeFace::BOTTOM ] = bottom;
-            mpCube[x + z * mCubeCols].mFace[ Cube::CubeFace::LEFT   ] = left;
-            mpCube[x + z * mCubeCols].mFace[ Cube::CubeFace::RIGHT  ] = right;
-            mpCube[x + z * mCubeCols].mFace[ Cube::CubeFace::NEAR   ] = front;
-            mpCube[x + z * mCubeCols].mFace[ Cube::CubeFace::FAR    ] = back;
-        } // for(uint x=0; x<mCubeCols; x++)
-    } // for(z=0; z<mCubeRows; z++)
-} // Level::load()
+        return false;
+    } // if( support == 0 )
 
-//! Check to see if the Player is directly on top of a physical Cube.
+    //! Calculate the distance from the center of the Cube to the Player position
+    float x = cubeX - position.x();
+    float z = cubeZ - position.z();
+
+    //! Calculate if the Player is on a edge of the Cube.
+    bool left  = qFuzzyCompare( x,  0.5f );
+    bool right = qFuzzyCompare( x, -0.5f );
+    bool far   = qFuzzyCompare( z,  0.5f );
+    bool near  = qFuzzyCompare( z, -0.5f );
+
+    //! Return true if a Cube supports the Player on a corner or an edge it is on.
+    return ( far  && left  && ( support & SUPPORT_FAR_LEFT   ) ) ||
+           ( far  && right && ( support & SUPPORT_FAR_RIGHT  ) ) ||
+           ( near && left  && ( support & SUPPORT_NEAR_LEFT  ) ) ||
+           ( near && right && ( support & SUPPORT_NEAR_RIGHT ) ) ||
+           ( left  && ( support & SUPPORT_LEFT  ) ) ||
+           ( right && ( support & SUPPORT_RIGHT ) ) ||
+           ( far   && ( support & SUPPORT_FAR   ) ) ||
+           ( near  && ( support & SUPPORT_NEAR  ) );
+} // Level::playerOnACube(const QVector3D &position)
+
+//! Check to see if the Player is directly on top of a physical Cube by searching the Cubes
+//! around it. Kept as the reference the cached support classification is verified against.
 //! \param position is the Player position.
 //! \return bool is true if player is on a Cube.
-bool Level::playerOnACube( const QVector3D & position )
+//! \sa playerOnACube
+bool Level::playerOnACubeSearch( const QVector3D & position )
 {
     //! Calculate the center of the Cube the position would be in.
     int cubeX = qRound( position.x() );
@@ -580,7 +770,7 @@ bool Level::playerOnACube( const QVector3D & position )
 
     //! Return false no Cube below Player position.
     return false;
-} // Level::playerOnACube(const QVector3D &position)
+} // Level::playerOnACubeSearch(const QVector3D &position)
 
 //! Check to see if the Player is at an interger height.
 //! \param position is the Player position to test.
@@ -601,6 +791,370 @@ bool Level::playerOnPlane( const QVector3D & position )
     return false;
 } // Level::playerOnPlane( const QVector3D& position )
 
+//! Start preparing the Level data for a Level on a worker thread.
+//! The next load of that Level takes the prepared Level data instead of parsing the Level file.
+//! \param levelIndex is the Level index to prepare.
+//! \param levelFile is the Level file to prepare instead of the Level index resource, when not empty.
+//! \return void
+void Level::prefetch( uint levelIndex, const QString & levelFile )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::prefetch( uint levelIndex, const QString & levelFile )...";
+
+    //! If the Level is already being prefetched there is nothing to do.
+    if( mPrefetching == true && mPrefetchIndex == levelIndex && mPrefetchFile == levelFile )
+    {
+        return;
+    } // if( mPrefetching == true && ... )
+
+    //! Drop a prefetch of another Level.
+    discard();
+
+    //! Start preparing the Level data on the global thread pool.
+    mPrefetchIndex = levelIndex;
+    mPrefetchFile  = levelFile;
+    mPrefetch      = QtConcurrent::run( &Level::prepare, levelIndex, levelFile, true );
+    mPrefetching   = true;
+} // Level::prefetch( uint levelIndex, const QString & levelFile )
+
+//! Prepare the Level data for a Level index: parse the Level file into the cell arrays and compute the visible faces.
+//! Touches no member and no OpenGL resource, so it can run on any thread.
+//! \param levelIndex is the Level index to prepare.
+//! \param levelFile is the Level file to prepare instead of the Level index resource, when not empty.
+//! \param faces is false to leave the visible faces and the support of a text Level file for the caller to compute.
+//! \return Prepared is the prepared Level data, its cell count is zero on failure.
+Level::Prepared Level::prepare( uint levelIndex, QString levelFile, bool faces )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::prepare( uint levelIndex, QString levelFile, bool faces )...";
+
+    //! The prepared Level data, empty until the Cubes are configured.
+    Prepared prepared;
+
+    //! A Level of a level pack is a view into the mapped pack, nothing is parsed or copied,
+    //! only the support bits and the culling results are allocated.
+    const LevelPack::Entry * pEntry = levelFile.isEmpty() ? LevelPack::instance().entry( levelIndex ) : NULL;
+
+    if( pEntry != NULL )
+    {
+        uint cubeCount = pEntry->columns * pEntry->rows;
+        prepared.pArena = Arena::acquire();
+        prepared.pArena->reserve( Arena::footprint< quint16 >( cubeCount ) +
+                                  Arena::footprint< bool >( renderCount( pEntry->columns, pEntry->rows, false ) ) );
+
+        quint16 * pCubeSupport = prepared.pArena->allocate< quint16 >( cubeCount );
+        computeSupport( pEntry->pHeight, pEntry->pType, pEntry->pSpans, pEntry->spanCount, pCubeSupport,
+                        pEntry->columns, pEntry->rows, 0, 0, pEntry->columns, pEntry->rows );
+        prepared.pCubeSupport = pCubeSupport;
+
+        prepared.pCubeHeight   = pEntry->pHeight;
+        prepared.pCubeType     = pEntry->pType;
+        prepared.pCubeFaces    = pEntry->pFaces;
+        prepared.pSpans        = pEntry->pSpans;
+        prepared.spanCount     = pEntry->spanCount;
+        prepared.cubeColumns   = pEntry->columns;
+        prepared.cubeRows      = pEntry->rows;
+        prepared.cubeCount     = cubeCount;
+        prepared.startPosition = pEntry->startPosition;
+        prepared.views         = true;
+        return prepared;
+    } // if( pEntry != NULL )
+
+    //! Create Level file name with Level index, unless a Level file has been given.
+    QString name( levelFile.isEmpty() ? LevelPack::instance().name( levelIndex ) : levelFile );
+
+    //! Create a file handle.
+    QFile file( name );
+
+    //! Verify the level file exists.
+    if( file.exists() == false )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - File does NOT exists - " << name <<"...";
+        prepared.error = name + ": the level file does not exist";
+        //! If it does not exists return without loading Level.
+        return prepared;
+    } // if( file.exists() == false )
+
+    //! A chunk file is not parsed, its chunks are read on demand once the Level is loaded.
+    if( ChunkStore::isChunkFile( name ) == true )
+    {
+        ChunkStore * pChunks = new ChunkStore( name, LEVEL_CHUNK_PACKED );
+
+        //! Read the chunk file header.
+        if( pChunks->open() == false )
+        {
+            TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Unable to open chunk file...";
+            prepared.error = name + ": unable to open the chunk file";
+            //! If it fails to open return without loading Level.
+            delete pChunks;
+            return prepared;
+        } // if( pChunks->open() == false )
+
+        //! Size the Level Arena for the culling results and the render window.
+        uint window = renderCount( pChunks->columns(), pChunks->rows(), true );
+        prepared.pArena = Arena::acquire();
+        prepared.pArena->reserve( 3 * Arena::footprint< quint8 >( window ) + Arena::footprint< bool >( window ) );
+
+        prepared.pChunks       = pChunks;
+        prepared.cubeColumns   = pChunks->columns();
+        prepared.cubeRows      = pChunks->rows();
+        prepared.cubeCount     = pChunks->columns() * pChunks->rows();
+        prepared.startPosition = pChunks->startPosition();
+        return prepared;
+    } // if( ChunkStore::isChunkFile( name ) == true )
+
+    //! Open the file for reading.
+    if( file.open( QIODevice::ReadOnly ) == false )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Unable to open Level file...";
+        prepared.error = name + ": unable to open the level file";
+        //! If it fails to open return without loading Level.
+        return prepared;
+    } // if( file.open( QIODevice::ReadOnly ) == false )
+
+    //! Parse the file where it lies, mapped when the file system allows it, else read in one
+    //! piece, a compressed resource cannot be mapped. The file stays open until it is parsed.
+    QByteArray contents;
+    qint64 size = file.size();
+    const uchar * pMapped = ( size > 0 ) ? file.map( 0, size ) : NULL;
+
+    if( pMapped == NULL )
+    {
+        contents = file.readAll();
+        size     = contents.size();
+    } // if( pMapped == NULL )
+
+    LevelParser parser( ( pMapped != NULL ) ? (const char *)pMapped : contents.constData(), size );
+
+    //! Determine how many cubes are in the level, a column per value of the first line and a row per line.
+    if( parser.measure() == false )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Level file corrupt...";
+        prepared.error = name + " " + parser.error();
+        return prepared;
+    } // if( parser.measure() == false )
+
+    uint cubeColumns = parser.columns();
+    uint cubeRows    = parser.rows();
+    uint cubeCount   = cubeColumns * cubeRows;
+
+    //! Size the Level Arena for the packed cell arrays, the support bits and the culling results,
+    //! so every allocation of the Level shares one block, then cut the cell arrays out of it.
+    prepared.pArena = Arena::acquire();
+    prepared.pArena->reserve( 3 * Arena::footprint< quint8 >( cubeCount ) + Arena::footprint< quint16 >( cubeCount ) +
+                              Arena::footprint< bool >( renderCount( cubeColumns, cubeRows, false ) ) );
+    quint8 *  pCubeHeight  = prepared.pArena->allocate< quint8 >( cubeCount );
+    quint8 *  pCubeType    = prepared.pArena->allocate< quint8 >( cubeCount );
+    quint8 *  pCubeFaces   = prepared.pArena->allocate< quint8 >( cubeCount );
+    quint16 * pCubeSupport = prepared.pArena->allocate< quint16 >( cubeCount );
+    prepared.pCubeHeight  = pCubeHeight;
+    prepared.pCubeType    = pCubeType;
+    prepared.pCubeFaces   = pCubeFaces;
+    prepared.pCubeSupport = pCubeSupport;
+
+    //! Configure the cubes, decoding the Type and height of every Cube straight into the cell arrays.
+    if( parser.parse( pCubeHeight, pCubeType ) == false )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "Level::Load( QString level ) - Level file corrupt...";
+        //! Release the partly configured Cubes and return without loading Level.
+        release( prepared );
+        prepared.error = name + " " + parser.error();
+        return prepared;
+    } // if( parser.parse( pCubeHeight, pCubeType ) == false )
+
+    prepared.startPosition = parser.startPosition();
+
+    //! Copy the Spans out of the parser, only a Level with bridges, tunnels or overhangs has any.
+    uint spanCount = parser.spans().size();
+
+    if( spanCount != 0 )
+    {
+        Cube::Span * pSpans = prepared.pArena->allocate< Cube::Span >( spanCount );
+        memcpy( pSpans, parser.spans().constData(), spanCount * sizeof( Cube::Span ) );
+        prepared.pSpans    = pSpans;
+        prepared.spanCount = spanCount;
+    } // if( spanCount != 0 )
+
+    //! The file is parsed, close and unmap it.
+    file.close();
+
+    //! Turn off hidden faces. Face that can never be seen such as between adjacent Cubes.
+    //! Classify the support of every cell, the Spans are in place.
+    if( faces == true )
+    {
+        computeFaces( pCubeHeight, pCubeType, pCubeFaces, cubeColumns, cubeRows, 0, 0, cubeColumns, cubeRows );
+        computeSupport( pCubeHeight, pCubeType, prepared.pSpans, prepared.spanCount, pCubeSupport,
+                        cubeColumns, cubeRows, 0, 0, cubeColumns, cubeRows );
+    } // if( faces == true )
+
+    //! The Level data is complete.
+    prepared.cubeColumns = cubeColumns;
+    prepared.cubeRows    = cubeRows;
+    prepared.cubeCount   = cubeCount;
+
+    //! A Level file, unlike a resource, can change while it is played.
+    if( name.startsWith( ":" ) == false )
+    {
+        prepared.file = name;
+    } // if( name.startsWith( ":" ) == false )
+
+    //! Level data prepared successfully return it.
+    return prepared;
+} // Level::prepare( uint levelIndex, QString levelFile )
+
+//! Apply the cell edits: the visible faces and the support bits are computed again over the
+//! rectangle of the edited cells grown by a cell, and the support classification of the last
+//! cell is dropped if an edited cell is around it. The cost is bound by the rectangle, not the Level.
+//! \return void
+void Level::rebuild()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::rebuild()...";
+
+    //! Nothing was edited.
+    if( mDirtyFirstX > mDirtyLastX || mDirtyFirstZ > mDirtyLastZ )
+    {
+        return;
+    } // if( mDirtyFirstX > mDirtyLastX || ... )
+
+    //! An edited cell changes the faces and the support of its neighbours.
+    uint firstX = ( mDirtyFirstX > 0 ) ? mDirtyFirstX - 1 : 0;
+    uint firstZ = ( mDirtyFirstZ > 0 ) ? mDirtyFirstZ - 1 : 0;
+    uint lastX  = qMin( mDirtyLastX + 2, mCubeColumns );
+    uint lastZ  = qMin( mDirtyLastZ + 2, mCubeRows );
+    computeFaces( mpCubeHeight, mpCubeType, writable( mpCubeFaces ), mCubeColumns, mCubeRows, firstX, firstZ, lastX, lastZ );
+    computeSupport( mpCubeHeight, mpCubeType, mpSpans, mSpanCount, writable( mpCubeSupport ),
+                    mCubeColumns, mCubeRows, firstX, firstZ, lastX, lastZ );
+
+    //! The support classification is stale if an edited cell is around the classified cell.
+    if( mSupportX + 1 >= (int)mDirtyFirstX && mSupportX - 1 <= (int)mDirtyLastX &&
+        mSupportZ + 1 >= (int)mDirtyFirstZ && mSupportZ - 1 <= (int)mDirtyLastZ )
+    {
+        mSupportCached = false;
+    } // if( mSupportX + 1 >= (int)mDirtyFirstX && ... )
+
+    //! The Cubes changed, the rectangle is empty again.
+    mGeneration++;
+    mDirtyFirstX = ~0u;
+    mDirtyFirstZ = ~0u;
+    mDirtyLastX  = 0;
+    mDirtyLastZ  = 0;
+} // Level::rebuild()
+
+//! Release prepared Level data that will not be used.
+//! \param prepared is the prepared Level data, emptied as it is released.
+//! \return void
+void Level::release( Prepared & prepared )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::release( Prepared & prepared )...";
+
+    //! Release the packed cell arrays with a reset of the Arena, and the ChunkStore.
+    Arena::recycle( prepared.pArena );
+    delete prepared.pChunks;
+    prepared.pArena       = NULL;
+    prepared.pCubeHeight  = NULL;
+    prepared.pCubeType    = NULL;
+    prepared.pCubeFaces   = NULL;
+    prepared.pCubeSupport = NULL;
+    prepared.pSpans       = NULL;
+    prepared.pChunks      = NULL;
+    prepared.spanCount    = 0;
+    prepared.cubeColumns  = 0;
+    prepared.cubeRows     = 0;
+    prepared.cubeCount    = 0;
+} // Level::release( Prepared & prepared )
+
+//! Apply the changes of the Level file to the loaded Level, keeping the Player state.
+//! The file is parsed again and diffed against the cells by row, only the changed cells
+//! are written, the visible faces are only computed again around them, and the support
+//! classification is kept unless a changed cell can support the Player in its cell. Every
+//! query and the next render see the new cells. A Level file whose size or Spans changed
+//! replaces the Level instead.
+//! \return int is the number of cells changed, -1 when the Level was not reloaded, the
+//! Level is kept and loadError() tells why.
+int Level::reload()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::reload()...";
+
+    //! Level data prefetched from the file before it changed is stale.
+    discard();
+
+    //! Only a Level parsed from a Level file can change.
+    if( mpArena == NULL || mSourceFile.isEmpty() == true )
+    {
+        return -1;
+    } // if( mpArena == NULL || mSourceFile.isEmpty() == true )
+
+    //! Parse the cells, the faces and the support are computed once the changed cells are known.
+    Prepared prepared = prepare( 0, mSourceFile, false );
+
+    if( prepared.cubeCount == 0 || prepared.pChunks != NULL )
+    {
+        mLoadError = ( prepared.pChunks != NULL ) ? mSourceFile + ": a chunk file cannot be reloaded" : prepared.error;
+        release( prepared );
+        return -1;
+    } // if( prepared.cubeCount == 0 || prepared.pChunks != NULL )
+
+    //! The prepared cell arrays are out of its Arena, the faces and the support are written there.
+    uint columns = prepared.cubeColumns;
+    uint rows    = prepared.cubeRows;
+    mStartPosition = prepared.startPosition;
+    mLoadError.clear();
+
+    //! The Spans are not edited, they are compared as a whole.
+    bool spansChanged = ( prepared.spanCount != mSpanCount ) ||
+                        std::equal( mpSpans, mpSpans + mSpanCount, prepared.pSpans,
+                                    []( const Cube::Span & span, const Cube::Span & other )
+                                    {
+                                        return span.cell == other.cell && span.type == other.type &&
+                                               span.bottom == other.bottom && span.top == other.top;
+                                    } ) == false;
+
+    //! A Level of another size, or with other Spans, is replaced.
+    if( columns != mCubeColumns || rows != mCubeRows || spansChanged == true )
+    {
+        computeFaces( prepared.pCubeHeight, prepared.pCubeType, writable( prepared.pCubeFaces ), columns, rows, 0, 0, columns, rows );
+        computeSupport( prepared.pCubeHeight, prepared.pCubeType, prepared.pSpans, prepared.spanCount,
+                        writable( prepared.pCubeSupport ), columns, rows, 0, 0, columns, rows );
+        adopt( prepared );
+        return mCubeCount;
+    } // if( columns != mCubeColumns || rows != mCubeRows || spansChanged == true )
+
+    //! Diff the rows, writing the changed cells as one batch of edits.
+    quint8 * pHeight = writable( mpCubeHeight );
+    quint8 * pType   = writable( mpCubeType );
+    int changed = 0;
+
+    beginEdit();
+
+    for( uint z = 0; z < rows; z++ )
+    {
+        uint row = z * columns;
+
+        //! Most rows are unchanged, they are skipped with two compares.
+        if( memcmp( pHeight + row, prepared.pCubeHeight + row, columns ) == 0 &&
+            memcmp( pType + row, prepared.pCubeType + row, columns ) == 0 )
+        {
+            continue;
+        } // if( memcmp( ... ) == 0 && ... )
+
+        for( uint x = 0; x < columns; x++ )
+        {
+            uint i = row + x;
+
+            if( pHeight[ i ] != prepared.pCubeHeight[ i ] || pType[ i ] != prepared.pCubeType[ i ] )
+            {
+                pHeight[ i ] = prepared.pCubeHeight[ i ];
+                pType[ i ]   = prepared.pCubeType[ i ];
+                dirty( x, z );
+                changed++;
+            } // if( pHeight[ i ] != prepared.pCubeHeight[ i ] || ... )
+        } // for( uint x = 0; x < columns; x++ )
+    } // for( uint z = 0; z < rows; z++ )
+
+    endEdit();
+    release( prepared );
+
+    return changed;
+} // Level::reload()
+
 //! Render the Opengl resources for the Level.
 //! \param camera is a const reference to Camera viewing the scene.
 //! \param light is a const reference to the Light lightinh the scene.
@@ -609,34 +1163,248 @@ void Level::render( const Camera & camera, const Light & light )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Level::render( const Camera & camera, const Light & light )...";
 
-    //! Verify the Cube array pointer is valid.
-    if( mpCube != NULL )
+    //! Verify the Level data is loaded.
+    if( mCubeCount != 0 )
     {
+        const quint8 * pHeight = mpCubeHeight;
+        const quint8 * pType   = mpCubeType;
+        const quint8 * pFaces  = mpCubeFaces;
+        uint originX = 0;
+        uint originZ = 0;
+        uint columns = mCubeColumns;
+        uint count   = mCubeCount;
+
+        //! A chunked Level only renders the cells within the far clipping plane of the Camera,
+        //! they are copied out of the ChunkStore, reading their chunks if they are not resident.
+        if( mpChunks != NULL )
+        {
+            int reach = (int)CAMERA_FAR_CLIPPING_PLANE_DISTANCE + 1;
+            int firstX = qBound( 0, qRound( camera.eye().x() ) - reach, (int)mCubeColumns );
+            int firstZ = qBound( 0, qRound( camera.eye().z() ) - reach, (int)mCubeRows );
+            int lastX  = qBound( 0, qRound( camera.eye().x() ) + reach + 1, (int)mCubeColumns );
+            int lastZ  = qBound( 0, qRound( camera.eye().z() ) + reach + 1, (int)mCubeRows );
+
+            originX = firstX;
+            originZ = firstZ;
+            columns = lastX - firstX;
+            count   = columns * ( lastZ - firstZ );
+
+            if( count != 0 )
+            {
+                mpChunks->copy( originX, originZ, columns, lastZ - firstZ, mpWindowHeight, mpWindowType, mpWindowFaces );
+            } // if( count != 0 )
+
+            pHeight = mpWindowHeight;
+            pType   = mpWindowType;
+            pFaces  = mpWindowFaces;
+        } // if( mpChunks != NULL )
+
+        //! Cull the Cubes against the Camera on the Jobs workers, only OpenGL calls must stay on this thread.
+        //! Holes are never rendered so they are not culled.
+        bool * pVisible = mpVisible;
+        Jobs::instance().parallelFor( 0, count, LEVEL_CULL_GRAIN, [ &camera, pHeight, pType, originX, originZ, columns, pVisible ]( uint i )
+        {
+            pVisible[i] = ( pType[i] != Cube::HOLE ) &&
+                          camera.boxViewable( Cube::mBox + QVector3D( originX + i % columns, pHeight[i], originZ + i / columns ) );
+        } ); // Jobs::instance().parallelFor( 0, count, LEVEL_CULL_GRAIN, ... )
+
         //! Loop through all the Cube in the Level.
-        for(uint i=0; i<mCubeCount; i++)
+        for(uint i=0; i<count; i++)
+        {
+            //! Render the Cube, if it is in the view of the Camera.
+            if( pVisible[i] == true )
+            {
+                Cube::render( camera, light, QVector3D( originX + i % columns, pHeight[i], originZ + i / columns ), (Cube::CubeType)pType[i], pFaces[i] );
+            } // if( pVisible[i] == true )
+        } // for(uint i=0; i<count; i++)
+
+        //! Loop through the Cubes of the Spans, few enough to be culled here. A Cube of a Span
+        //! shows its sides, its bottom when it is the lowest and its top when it is the highest.
+        quint8 sides = Cube::faceBit( Cube::LEFT ) | Cube::faceBit( Cube::RIGHT ) |
+                       Cube::faceBit( Cube::NEAR ) | Cube::faceBit( Cube::FAR );
+
+        for( uint s = 0; s < mSpanCount; s++ )
         {
-            //! Render the Cube.
-            mpCube[i].render( camera, light );
-        } // for(uint i=0; i<mCubeCount; i++)
-    } // if( mpCube != NULL )
+            const Cube::Span & span = mpSpans[ s ];
+
+            for( int y = span.bottom; y <= span.top; y++ )
+            {
+                QVector3D position( span.cell % mCubeColumns, y, span.cell / mCubeColumns );
+
+                //! Render the Cube, if it is in the view of the Camera.
+                if( camera.boxViewable( Cube::mBox + position ) == true )
+                {
+                    quint8 faces = sides | ( ( y == span.bottom ) ? Cube::faceBit( Cube::BOTTOM ) : 0 ) |
+                                           ( ( y == span.top )    ? Cube::faceBit( Cube::TOP )    : 0 );
+
+                    Cube::render( camera, light, position, (Cube::CubeType)span.type, faces );
+                } // if( camera.boxViewable( Cube::mBox + position ) == true )
+            } // for( int y = span.bottom; y <= span.top; y++ )
+        } // for( uint s = 0; s < mSpanCount; s++ )
+    } // if( mCubeCount != 0 )
 } // Level::render( const Camera & camera, const Light & light )
 
+//! Get the most cells rendered at once, they are culled into an array of that size.
+//! \param columns is the number of Cube columns in the Level.
+//! \param rows is the number of Cube rows in the Level.
+//! \param chunked is true for a chunked Level, which only renders the cells within the far
+//! clipping plane around the Camera eye.
+//! \return uint is the number of cells.
+uint Level::renderCount( uint columns, uint rows, bool chunked )
+{
+    //! The window spans the reach of the Camera either side of the cell of the eye.
+    if( chunked == true )
+    {
+        uint span = 2 * ( (uint)CAMERA_FAR_CLIPPING_PLANE_DISTANCE + 1 ) + 1;
+        return qMin( columns, span ) * qMin( rows, span );
+    } // if( chunked == true )
+
+    return columns * rows;
+} // Level::renderCount( uint columns, uint rows, bool chunked )
+
+//! Report the Arena counters, and the chunk cache counters of a chunked Level.
+//! \param out is the stream to report to.
+//! \return void
+void Level::report( QTextStream & out )
+{
+    if( mpArena != NULL )
+    {
+        out << "arena: level uses " << mpArena->used() << " of " << mpArena->reserved() << " bytes" << endl;
+    } // if( mpArena != NULL )
+
+    Arena::report( out );
+
+    if( mpChunks != NULL )
+    {
+        mpChunks->report( out );
+    } // if( mpChunks != NULL )
+} // Level::report( QTextStream & out )
+
+//! Set the Cube height of a cell, applied now or at the end of the batch of edits.
+//! In the threaded mode the edit is forwarded to the Level of the Simulation thread, which
+//! applies the batch before its next tick.
+//! \param column is the X position in the Level.
+//! \param row is the Z position in the Level.
+//! \param height is the Cube height, from 0 to 255.
+//! \return bool is false when the cell cannot be edited, outside the Level or in a chunked Level,
+//! or when its Cube would overlap one of the Spans of the cell.
+//! \sa beginEdit, endEdit
+bool Level::setCubeHeight( uint column, uint row, int height )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::setCubeHeight( uint column, uint row, int height )...";
+
+    if( editable( column, row ) == false )
+    {
+        return false;
+    } // if( editable( column, row ) == false )
+
+    uint cell = column + row * mCubeColumns;
+    height = qBound( 0, height, 255 );
+
+    //! The Cube of the cell cannot move into one of its Spans, the same as in a Level file.
+    if( mpCubeType[ cell ] != Cube::HOLE && spanAtHeight( mpSpans, mSpanCount, cell, height ) != NULL )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "Level::setCubeHeight() - the Span overlaps the Cube of the cell...";
+        return false;
+    } // if( mpCubeType[ cell ] != Cube::HOLE && ... )
+
+    writable( mpCubeHeight )[ cell ] = (quint8)height;
+    dirty( column, row );
+
+    //! An edit out of any batch is a batch of its own.
+    if( mpSimulation != NULL )
+    {
+        mpSimulation->edit( column, row, height, -1 );
+
+        if( mEditDepth == 0 )
+        {
+            mpSimulation->endEdit();
+        } // if( mEditDepth == 0 )
+    } // if( mpSimulation != NULL )
+
+    return true;
+} // Level::setCubeHeight( uint column, uint row, int height )
+
+//! Set the CubeType of a cell, applied now or at the end of the batch of edits.
+//! A cell made a Hole crumbles away, the Player falls once the edit is applied.
+//! In the threaded mode the edit is forwarded to the Level of the Simulation thread, which
+//! applies the batch before its next tick.
+//! \param column is the X position in the Level.
+//! \param row is the Z position in the Level.
+//! \param type is the CubeType.
+//! \return bool is false when the cell cannot be edited, outside the Level or in a chunked Level,
+//! or when a Hole made solid would overlap one of the Spans of the cell.
+//! \sa beginEdit, endEdit
+bool Level::setCubeType( uint column, uint row, Cube::CubeType type )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Level::setCubeType( uint column, uint row, Cube::CubeType type )...";
+
+    if( editable( column, row ) == false )
+    {
+        return false;
+    } // if( editable( column, row ) == false )
+
+    uint cell = column + row * mCubeColumns;
+
+    //! The height of a Hole is free, a Cube made there cannot be inside one of the Spans.
+    if( type != Cube::HOLE && spanAtHeight( mpSpans, mSpanCount, cell, mpCubeHeight[ cell ] ) != NULL )
+    {
+        TraceOut( TRACE_FILE_EXECUTION ) << "Level::setCubeType() - the Span overlaps the Cube of the cell...";
+        return false;
+    } // if( type != Cube::HOLE && ... )
+
+    writable( mpCubeType )[ cell ] = (quint8)type;
+    dirty( column, row );
+
+    //! An edit out of any batch is a batch of its own.
+    if( mpSimulation != NULL )
+    {
+        mpSimulation->edit( column, row, -1, type );
+
+        if( mEditDepth == 0 )
+        {
+            mpSimulation->endEdit();
+        } // if( mEditDepth == 0 )
+    } // if( mpSimulation != NULL )
+
+    return true;
+} // Level::setCubeType( uint column, uint row, Cube::CubeType type )
+
+//! Find the Span of a cell holding a Cube at a height.
+//! The Spans of the cell are found with a binary search, then scanned from the bottom up.
+//! \param pSpans is the Spans sorted by cell.
+//! \param spanCount is the number of Spans.
+//! \param cell is the index of the cell.
+//! \param y is the height.
+//! \return const Cube::Span * is the Span holding a Cube at the height, NULL when none does.
+const Cube::Span * Level::spanAtHeight( const Cube::Span * pSpans, uint spanCount, uint cell, int y )
+{
+    const Cube::Span * pEnd  = pSpans + spanCount;
+    const Cube::Span * pSpan = std::lower_bound( pSpans, pEnd, cell, []( const Cube::Span & span, uint index )
+    {
+        return span.cell < index;
+    } ); // std::lower_bound( pSpans, pEnd, cell, ... )
+
+    for( ; pSpan != pEnd && pSpan->cell == cell && pSpan->bottom <= y; pSpan++ )
+    {
+        if( y <= pSpan->top )
+        {
+            return pSpan;
+        } // if( y <= pSpan->top )
+    } // for( ; pSpan != pEnd && ... )
+
+    return NULL;
+} // Level::spanAtHeight( const Cube::Span * pSpans, uint spanCount, uint cell, int y )
+
+
 //! Update the Level.
 //! \return void
 void Level::tick()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Level::tick()...";
 
-    //! Verify the Cube array pointer is valid.
-    if( mpCube != NULL )
-    {
-        //! Loop through all the Cube in the Level.
-        for(uint i=0; i<mCubeCount; i++)
-        {
-            //! Update the Cube.
-            mpCube[i].tick();
-        } // for(uint i=0; i<mCubeCount; i++)
-    } // if( mpCube != NULL )
+    //! Update the Cubes.
+    Cube::tick();
 } // Level::tick()
 
 //! Unload the Level.
@@ -648,12 +1416,34 @@ void Level::unload()
     //! Unload the Cube OpenGL resources.
     Cube::unload();
 
-    //! If the Cube array pointer is valid.
-    if( mpCube != NULL )
+    //! If Level data is loaded.
+    if( mpArena != NULL )
     {
-        //! Release the allocated memory.
-        delete [] mpCube;
-        //! Set the Cube array pointer to NULL.
-        mpCube = NULL;
-    } // if( mpCube != NULL )
+        //! Release every Level allocation with a single reset of the Arena, and the ChunkStore.
+        Arena::recycle( mpArena );
+        delete mpChunks;
+        mpArena        = NULL;
+        mpCubeHeight   = NULL;
+        mpCubeType     = NULL;
+        mpCubeFaces    = NULL;
+        mpCubeSupport  = NULL;
+        mpSpans        = NULL;
+        mpVisible      = NULL;
+        mpWindowHeight = NULL;
+        mpWindowType   = NULL;
+        mpWindowFaces  = NULL;
+        mpChunks       = NULL;
+        mCubeColumns = 0;
+        mCubeRows    = 0;
+        mCubeCount   = 0;
+        mSpanCount   = 0;
+        mSourceFile.clear();
+        mViews = false;
+
+        //! The Cubes changed, the last support classification is stale.
+        mGeneration++;
+        mSupportCached = false;
+
+        account();
+    } // if( mpArena != NULL )
 } // Level::unload()
@@ -6,32 +6,82 @@ This file contains the Level class declaratio for the application.
 #ifndef LEVEL_H
 #define LEVEL_H
 
+// QFuture header file required for the prefetched Level data.
+#include <QFuture>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+
+// arena.h header file required for the Level Arena.
+#include "arena.h"
 // camera.h header file required for rendering.
 #include "camera.h"
+// chunkstore.h header file required for the Levels stored in chunk files.
+#include "chunkstore.h"
 // cube.h header file required for class definition.
 #include "cube.h"
 // light.h header file required for rendering.
 #include "light.h"
 
+//! Simulation class forward declaration, the edits are forwarded to its Level.
+class Simulation;
+
 //! Level class.
 /*!
 This class declaration encapsulates the Level functionality.
+The cells are packed byte arrays of the Cube height, the CubeType and the visible faces.
+The other Cubes of a cell, for bridges, tunnels and overhangs, are stacked in Spans.
+The allocations of a Level are cut out of one Arena and released with a single reset.
+A Level too large for memory is read on demand from a chunk file through a ChunkStore.
+A Level of a level pack views its cell arrays in the mapped pack.
+The Level data is prepared off the render thread, only the OpenGL upload runs on it.
+The cells are edited in batches applied over a dirty rectangle, a changed file as one batch.
+The support of every cell on the plane of its Cube is classified with the cell arrays.
 */
 class Level
 {
+    //! Friend of Engine so that it can forward the edits to the Simulation thread.
+    friend class Engine;
+
+    //! Friend of LevelPack so that it can prepare the Levels it packs.
+    friend class LevelPack;
+
     //! Friend of World so that only World can instantiate the Level.
     friend class World;
 
 public: // Access Functions
+    //! Called to get the Arena of the Level allocations, NULL when no Level is loaded.
+    const Arena * arena() const { return mpArena; }
+
+    //! Called to get the number of Cube columns in the Level.
+    uint cubeColumns() { return mCubeColumns; }
+
+    //! Called to get the number of Cube rows in the Level.
+    uint cubeRows() { return mCubeRows; }
+
+    //! Called to get the Cube height at a location in the Level.
+    int cubeHeight( uint column, uint row );
+
     //! Called to get the Cube size.
     float cubeSize() { return mCubeSize; }
 
     //! Called to get the Cube type at a location in the Level.
     Cube::CubeType cubeType( uint column, uint row );
 
+    //! Called to get the generation of the Level data, changed whenever the Cubes change.
+    uint generation() const { return mGeneration; }
+
     //! Called to get/set the current Level index.
     uint & levelIndex() { return mLevelIndex; }
 
+    //! Called to get/set a Level file to load instead of the Level index resource.
+    QString & levelFile() { return mLevelFile; }
+
+    //! Called to get why the last Level failed to load, empty when it loaded.
+    const QString & loadError() const { return mLoadError; }
+
+    //! Called to get the Level file the loaded Level was parsed from, empty when it cannot change.
+    const QString & sourceFile() const { return mSourceFile; }
+
     //! Called to get the start position for the Level.
     QVector3D & startPosition() { return mStartPosition; }
 
@@ -39,22 +89,52 @@ public: // Query Functions
     //! Called to find out if there is a physical Cube at the position specified.
     bool cubeAtPosition( int x, int y, int z );
 
+    //! Called to get the type of the physical Cube at the position specified, Hole when there is none.
+    Cube::CubeType cubeTypeAt( int x, int y, int z );
+
     //! Called to find out if the position is with in the Level.
     bool insideLevel( const QVector3D & position );
 
     //! Called to find out if the Player Position is directly on top of a physical Cube.
     bool playerOnACube( const QVector3D & position );
 
+    //! Called to find out if the Player Position is on a physical Cube by searching the Cubes, the reference for playerOnACube.
+    bool playerOnACubeSearch( const QVector3D & position );
+
     //! Called to find out if the Player is on a plane.
     bool playerOnPlane( const QVector3D& position );
 
 public: // Member Functions
+    //! Called to start a batch of cell edits.
+    void beginEdit();
+
+    //! Called to end a batch of cell edits, applying them.
+    void endEdit();
+
     //! Called to load the Level OpenGL resources.
     void load();
 
+    //! Called to load the Level data without any OpenGL resources.
+    bool loadData();
+
+    //! Called to start preparing the Level data for a Level on a worker thread.
+    void prefetch( uint levelIndex, const QString & levelFile );
+
+    //! Called to apply the changes of the Level file to the loaded Level.
+    int reload();
+
     //! Called to render the Level OpenGL resources.
     void render( const Camera & camera, const Light & light );
 
+    //! Called to report the Arena counters and the chunk cache counters of a chunked Level.
+    void report( QTextStream & out );
+
+    //! Called to set the Cube height at a location in the Level.
+    bool setCubeHeight( uint column, uint row, int height );
+
+    //! Called to set the Cube type at a location in the Level.
+    bool setCubeType( uint column, uint row, Cube::CubeType type );
+
     //! Called to update the Level.
     void tick();
 
@@ -68,18 +148,155 @@ private: // Constructors / Destructors
     //! Level class destructor.
     ~Level();
 
+private: // Data Types
+    //! Internal Level data prepared off the render thread.
+    struct Prepared
+    {
+        //! - Arena of the Level allocations, NULL when the Level failed to prepare.
+        Arena * pArena = NULL;
+        //! - Height of the Cube of every cell, out of the Arena or the level pack, NULL for a chunked Level.
+        const quint8 * pCubeHeight = NULL;
+        //! - CubeType of every cell, out of the Arena or the level pack.
+        const quint8 * pCubeType = NULL;
+        //! - Mask of the visible faces of every cell, out of the Arena or the level pack.
+        const quint8 * pCubeFaces = NULL;
+        //! - Support bits of every cell on the plane of its Cube, out of the Arena, NULL for a chunked Level.
+        const quint16 * pCubeSupport = NULL;
+        //! - Spans sorted by cell, out of the Arena or the level pack, NULL when there are none.
+        const Cube::Span * pSpans = NULL;
+        //! - Number of Spans.
+        uint spanCount = 0;
+        //! - ChunkStore of a chunked Level, used instead of the cell arrays, NULL otherwise.
+        ChunkStore * pChunks = NULL;
+        //! - Number of Cube columns.
+        uint cubeColumns = 0;
+        //! - Number of Cube rows.
+        uint cubeRows = 0;
+        //! - Number of Cube.
+        uint cubeCount = 0;
+        //! - Start location of the Level.
+        QVector3D startPosition;
+        //! - Why the Level failed to prepare, with the line and column of a malformed Level file.
+        QString error;
+        //! - Level file the Level was parsed from, empty for a resource, a level pack Level or a chunk file.
+        QString file;
+        //! - True when the cell arrays are views into the level pack, not out of the Arena.
+        bool views = false;
+    }; // struct Prepared
+
+    //! Internal support bits of a cell classification, one per Cube that can support the Player.
+    enum Support
+    {
+        SUPPORT_CENTRE     = 0x001, //!< - Cube of the cell.
+        SUPPORT_LEFT       = 0x002, //!< - Cube to the left.
+        SUPPORT_RIGHT      = 0x004, //!< - Cube to the right.
+        SUPPORT_FAR        = 0x008, //!< - Cube behind.
+        SUPPORT_NEAR       = 0x010, //!< - Cube in front.
+        SUPPORT_FAR_LEFT   = 0x020, //!< - Cube behind to the left.
+        SUPPORT_FAR_RIGHT  = 0x040, //!< - Cube behind to the right.
+        SUPPORT_NEAR_LEFT  = 0x080, //!< - Cube in front to the left.
+        SUPPORT_NEAR_RIGHT = 0x100  //!< - Cube in front to the right.
+    }; // enum Support
+
+private: // Helper Functions
+    //! Called to count the bytes of the Level Arena in the Memory of the Level arrays.
+    void account();
+
+    //! Called to take ownership of prepared Level data.
+    void adopt( Prepared & prepared );
+
+    //! Called to get the height of a cell inside the Level, from the cell arrays or the ChunkStore.
+    quint8 cellHeight( uint x, uint z )
+    { return ( mpChunks == NULL ) ? mpCubeHeight[ x + z * mCubeColumns ] : mpChunks->height( x, z ); }
+
+    //! Called to get the CubeType of a cell inside the Level, from the cell arrays or the ChunkStore.
+    quint8 cellType( uint x, uint z )
+    { return ( mpChunks == NULL ) ? mpCubeType[ x + z * mCubeColumns ] : mpChunks->type( x, z ); }
+
+    //! Called to classify the Cubes that can support the Player in a cell at a plane height.
+    uint classifySupport( int x, int y, int z );
+
+    //! Called to compute the visible faces of a rectangle of cells.
+    static void computeFaces( const quint8 * pHeight, const quint8 * pType, quint8 * pFaces,
+                              uint columns, uint rows, uint firstX, uint firstZ, uint lastX, uint lastZ );
+
+    //! Called to classify the support of a rectangle of cells on the plane of their Cube.
+    static void computeSupport( const quint8 * pHeight, const quint8 * pType, const Cube::Span * pSpans, uint spanCount,
+                                quint16 * pSupport, uint columns, uint rows, uint firstX, uint firstZ, uint lastX, uint lastZ );
+
+    //! Called to grow the rectangle of the edited cells by an edited cell.
+    void dirty( uint column, uint row );
+
+    //! Called to wait for a prefetch still running and release its Level data.
+    void discard();
+
+    //! Called to make a cell ready to edit, copying the cells of a level pack Level.
+    bool editable( uint column, uint row );
+
+    //! Called on any thread to prepare the Level data for a Level.
+    static Prepared prepare( uint levelIndex, QString levelFile, bool faces = true );
+
+    //! Called to apply the cell edits within the rectangle of the edited cells.
+    void rebuild();
+
+    //! Called to release prepared Level data that will not be used.
+    static void release( Prepared & prepared );
+
+    //! Called to get the most cells rendered at once, the whole Level or the window of a chunked Level.
+    static uint renderCount( uint columns, uint rows, bool chunked );
+
+    //! Called to find the Span of a cell holding a Cube at a height, NULL when none does.
+    static const Cube::Span * spanAtHeight( const Cube::Span * pSpans, uint spanCount, uint cell, int y );
+
+    //! Called to write cell arrays out of an Arena, never the views into a level pack, see editable().
+    template< typename T >
+    static T * writable( const T * pCells ) { return const_cast< T * >( pCells ); }
+
 private: // Member Variables
     //! Used to store the number of Cube in Level, initialized to zero.
     uint   mCubeCount = 0;
 
-    //! Used to store the number of Cube rows in Level, initialized to zero.
+    //! Used to store the number of Cube columns in Level, along X, initialized to zero.
+    uint   mCubeColumns = 0;
+
+    //! Used to store the number of Cube rows in Level, along Z, initialized to zero.
     uint   mCubeRows = 0;
 
-    //! Used to store the number of Cube columns in Level, initialized to zero.
-    uint   mCubeCols = 0;
+    //! Used to store the Arena of the Level allocations, NULL when no Level is loaded.
+    Arena * mpArena = NULL;
+
+    //! Used to store the bytes of the Arena counted in the Memory of the Level arrays.
+    qint64 mAccountedBytes = 0;
+
+    //! Used to store the height of the Cube of every cell, NULL when no Level is loaded.
+    const quint8 * mpCubeHeight = NULL;
+
+    //! Used to store the CubeType of every cell.
+    const quint8 * mpCubeType = NULL;
+
+    //! Used to store the mask of the visible faces of every cell.
+    const quint8 * mpCubeFaces = NULL;
 
-    //! Used to store the Cubes of the Level, initialized to null.
-    Cube * mpCube = NULL;
+    //! Used to store the support bits of every cell on the plane of its Cube, NULL for a chunked Level.
+    const quint16 * mpCubeSupport = NULL;
+
+    //! Used to store the Spans sorted by cell, NULL when the Level has none.
+    const Cube::Span * mpSpans = NULL;
+
+    //! Used to store the number of Spans.
+    uint mSpanCount = 0;
+
+    //! Used to store the ChunkStore of a chunked Level, NULL when the cell arrays are used.
+    ChunkStore * mpChunks = NULL;
+
+    //! Used to store the heights of the cells of a chunked Level within the reach of the Camera.
+    quint8 * mpWindowHeight = NULL;
+
+    //! Used to store the CubeTypes of the cells of a chunked Level within the reach of the Camera.
+    quint8 * mpWindowType = NULL;
+
+    //! Used to store the visible faces of the cells of a chunked Level within the reach of the Camera.
+    quint8 * mpWindowFaces = NULL;
 
     //! Used to store the Cube size, initialized to 1.0.
     const float mCubeSize = 1.0f;
@@ -87,8 +304,71 @@ private: // Member Variables
     //! Used to store the current Level index number, initialized to zero.
     uint mLevelIndex = 0;
 
+    //! Used to store a Level file that overrides the Level index when not empty.
+    QString mLevelFile;
+
+    //! Used to store why the last Level failed to load, empty when it loaded.
+    QString mLoadError;
+
+    //! Used to store the Level file the loaded Level was parsed from, empty when it cannot change.
+    QString mSourceFile;
+
+    //! Used to remember the cell arrays are views into a level pack, copied before an edit.
+    bool mViews = false;
+
+    //! Used to count the open batches of cell edits, the edits are applied when the last ends.
+    uint mEditDepth = 0;
+
+    //! Used to reference the Simulation thread the edits are forwarded to, NULL for the single threaded mode.
+    Simulation * mpSimulation = NULL;
+
+    //! Used to store the first column of the edited cells, past mDirtyLastX when none is edited.
+    uint mDirtyFirstX = ~0u;
+
+    //! Used to store the first row of the edited cells, past mDirtyLastZ when none is edited.
+    uint mDirtyFirstZ = ~0u;
+
+    //! Used to store the last column of the edited cells.
+    uint mDirtyLastX = 0;
+
+    //! Used to store the last row of the edited cells.
+    uint mDirtyLastZ = 0;
+
     //! Used to store the start location of the Level.
     QVector3D mStartPosition;
+
+    //! Used to count the changes of the Level data, initialized to zero.
+    uint mGeneration = 0;
+
+    //! Used to remember if the support classification of the last cell off the support bits is valid, initialized to false.
+    bool mSupportCached = false;
+
+    //! Used to store the column of the last classified cell.
+    int mSupportX = 0;
+
+    //! Used to store the plane height of the last classified cell.
+    int mSupportY = 0;
+
+    //! Used to store the row of the last classified cell.
+    int mSupportZ = 0;
+
+    //! Used to store the support classification of the last classified cell.
+    uint mSupport = 0;
+
+    //! Used to store which Cubes are in the view of the Camera, refreshed every render.
+    bool * mpVisible = NULL;
+
+    //! Used to store the Level data being prefetched on a worker thread.
+    QFuture< Prepared > mPrefetch;
+
+    //! Used to track if a prefetch was started and not yet taken.
+    bool mPrefetching = false;
+
+    //! Used to store the Level index being prefetched.
+    uint mPrefetchIndex = 0;
+
+    //! Used to store the Level file being prefetched.
+    QString mPrefetchFile;
 }; // class Level
 
 #endif // LEVEL_H
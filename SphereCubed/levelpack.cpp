@@ -0,0 +1,453 @@
+/*! \file levelpack.cpp
+\brief LevelPack class implementation file.
+This file contains the LevelPack class implementation for the application.
+*/
+
+// levelpack.h header file required for LevelPack class definition.
+#include "levelpack.h"
+
+// QCoreApplication header file required for finding the pack next to the executable.
+#include <QCoreApplication>
+// QDataStream header file required for the header and the table of contents.
+#include <QDataStream>
+// QFileInfo header file required for comparing the pack being written with the one being played.
+#include <QFileInfo>
+
+// analyzer.h header file required for the par of the packed Levels.
+#include "analyzer.h"
+// level.h header file required for preparing the packed Levels.
+#include "level.h"
+// memory.h header file required for counting the decoded Spans.
+#include "memory.h"
+// settings.h header file required for the level pack file name.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Level pack magic, 'SCPK'.
+#define PACK_MAGIC 0x5343504B
+
+//! Level pack format version.
+#define PACK_VERSION 2
+
+//! Bytes of the level pack header, the magic, the version and the Level count.
+#define PACK_HEADER_BYTES 12
+
+//! Bytes of a table of contents entry, the offset then the columns, rows, start X, Y and Z, par, checksum and Span count.
+#define PACK_ENTRY_BYTES 40
+
+//! Most cells of a packed Level.
+#define PACK_MAX_CELLS 0x7fffffff
+
+//! Bytes of a packed Span, its cell, CubeType, bottom and top.
+#define PACK_SPAN_BYTES 7
+
+//! Name of the Level files of a directory, numbered from one.
+#define PACK_DIRECTORY_FILE "/Level%1.lvl"
+
+//! Internal FNV-1a checksum of the cell arrays and the packed Spans of a Level.
+static quint32 packChecksum( const quint8 * pHeight, const quint8 * pType, const quint8 * pFaces, uint cells,
+                             const quint8 * pSpans, uint spanBytes )
+{
+    quint32 hash = 2166136261u;
+    const quint8 * planes[ 4 ] = { pHeight, pType, pFaces, pSpans };
+    uint sizes[ 4 ] = { cells, cells, cells, spanBytes };
+
+    for( int plane = 0; plane < 4; plane++ )
+    {
+        for( uint i = 0; i < sizes[ plane ]; i++ )
+        {
+            hash = ( hash ^ planes[ plane ][ i ] ) * 16777619u;
+        }
+    } // for( int plane = 0; plane < 4; plane++ )
+
+    return hash;
+} // packChecksum()
+
+//! The LevelPack execution begins here.
+//! Plays the pack next to the executable if there is one, else the Level resources.
+LevelPack::LevelPack()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelPack::LevelPack()...";
+
+    QString path = QCoreApplication::applicationDirPath() + "/" + LEVEL_PACK_FILE;
+
+    if( QFile::exists( path ) == false )
+    {
+        discover();
+    } // if( QFile::exists( path ) == false )
+    else if( open( path ) == false )
+    {
+        QTextStream( stderr ) << mError << endl;
+    } // if( QFile::exists( path ) == false ) else if( open( path ) == false )
+} // LevelPack::LevelPack()
+
+//! The LevelPack execution ends here.
+//! The pack is unmapped when its file closes.
+LevelPack::~LevelPack()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelPack::~LevelPack()...";
+} // LevelPack::~LevelPack()
+
+//! Count the bytes of the decoded Spans in the Memory of the Level arrays, replacing the
+//! bytes counted before, whenever the pack is opened or unmapped.
+//! \return void
+void LevelPack::account()
+{
+    qint64 bytes = (qint64)mSpans.size() * sizeof( Cube::Span );
+
+    if( bytes == mAccountedBytes )
+    {
+        return;
+    } // if( bytes == mAccountedBytes )
+
+    if( mAccountedBytes != 0 )
+    {
+        Memory::freed( Memory::LEVEL_ARRAYS, mAccountedBytes );
+    } // if( mAccountedBytes != 0 )
+
+    if( bytes != 0 )
+    {
+        Memory::allocated( Memory::LEVEL_ARRAYS, bytes );
+    } // if( bytes != 0 )
+
+    mAccountedBytes = bytes;
+} // LevelPack::account()
+
+//! Unmap the pack and count the Level resources, :Level1, :Level2 and so on until one is missing.
+//! \return void
+void LevelPack::discover()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelPack::discover()...";
+
+    mFile.close();
+    mEntries.clear();
+    mSpans.clear();
+    mDirectory.clear();
+    mCount = 0;
+    account();
+
+    while( QFile::exists( ":Level" + QString::number( mCount + 1 ) ) == true )
+    {
+        mCount++;
+    } // while( QFile::exists( ... ) == true )
+} // LevelPack::discover()
+
+//! Get a Level of the pack.
+//! \param levelIndex is the Level index, from one.
+//! \return const Entry * is the Level, NULL when the Levels are not packed or the index is out of range.
+const LevelPack::Entry * LevelPack::entry( uint levelIndex ) const
+{
+    if( levelIndex < 1 || levelIndex > (uint)mEntries.size() )
+    {
+        return NULL;
+    } // if( levelIndex < 1 || levelIndex > (uint)mEntries.size() )
+
+    return mEntries.constData() + levelIndex - 1;
+} // LevelPack::entry( uint levelIndex )
+
+//! Get the LevelPack shared by the process.
+//! The Levels are discovered on the first call.
+//! \return LevelPack & is the LevelPack.
+LevelPack & LevelPack::instance()
+{
+    static LevelPack pack;
+    return pack;
+} // LevelPack::instance()
+
+//! Get the name of a Level, to load it or to report it.
+//! \param levelIndex is the Level index, from one.
+//! \return QString is the Level resource or file, or the pack file and the place of the Level in it.
+QString LevelPack::name( uint levelIndex ) const
+{
+    if( mEntries.isEmpty() == false )
+    {
+        return mFile.fileName() + "#" + QString::number( levelIndex );
+    } // if( mEntries.isEmpty() == false )
+
+    if( mDirectory.isEmpty() == false )
+    {
+        return mDirectory + QString( PACK_DIRECTORY_FILE ).arg( levelIndex );
+    } // if( mDirectory.isEmpty() == false )
+
+    return ":Level" + QString::number( levelIndex );
+} // LevelPack::name( uint levelIndex )
+
+//! Map a level pack and play its Levels, checking its table of contents and checksums.
+//! Called on the main thread before any Level is loaded, the views of the previous pack end.
+//! \param path is the level pack file.
+//! \return bool is true on success, else the Level resources are played and error() tells why.
+bool LevelPack::open( const QString & path )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelPack::open( const QString & path )...";
+
+    discover();
+    mFile.setFileName( path );
+
+    if( mFile.open( QIODevice::ReadOnly ) == false )
+    {
+        mError = path + ": unable to open the level pack";
+        discover();
+        return false;
+    } // if( mFile.open( QIODevice::ReadOnly ) == false )
+
+    qint64 size = mFile.size();
+    const uchar * pMap = ( size >= PACK_HEADER_BYTES ) ? mFile.map( 0, size ) : NULL;
+
+    if( pMap == NULL )
+    {
+        mError = path + ": unable to map the level pack";
+        discover();
+        return false;
+    } // if( pMap == NULL )
+
+    //! Read the header and the table of contents out of the mapped pack.
+    QByteArray contents = QByteArray::fromRawData( (const char *)pMap, size );
+    QDataStream stream( contents );
+    quint32 magic   = 0;
+    quint32 version = 0;
+    quint32 count   = 0;
+    stream >> magic >> version >> count;
+
+    if( magic != PACK_MAGIC || version != PACK_VERSION || PACK_HEADER_BYTES + (qint64)count * PACK_ENTRY_BYTES > size )
+    {
+        mError = path + ": not a level pack of version " + QString::number( PACK_VERSION );
+        discover();
+        return false;
+    } // if( magic != PACK_MAGIC || ... )
+
+    QVector< Entry > entries;
+    QVector< Cube::Span > spans;
+    QVector< int > firstSpans;
+
+    for( quint32 index = 0; index < count; index++ )
+    {
+        quint64 offset;
+        quint32 columns, rows, startX, startY, startZ, par, checksum, spanCount;
+        stream >> offset >> columns >> rows >> startX >> startY >> startZ >> par >> checksum >> spanCount;
+
+        quint64 cells = (quint64)columns * rows;
+        quint64 spanBytes = (quint64)spanCount * PACK_SPAN_BYTES;
+
+        //! Every Level must lie inside the pack.
+        if( cells == 0 || cells > PACK_MAX_CELLS || offset > (quint64)size || 3 * cells + spanBytes > (quint64)size - offset )
+        {
+            mError = path + ": level " + QString::number( index + 1 ) + " lies outside the level pack";
+            discover();
+            return false;
+        } // if( cells == 0 || ... )
+
+        Entry entry;
+        entry.columns       = columns;
+        entry.rows          = rows;
+        entry.startPosition = QVector3D( startX, startY, startZ );
+        entry.par           = par;
+        entry.checksum      = checksum;
+        entry.pHeight       = pMap + offset;
+        entry.pType         = entry.pHeight + cells;
+        entry.pFaces        = entry.pType + cells;
+        entry.pSpans        = NULL;
+        entry.spanCount     = spanCount;
+
+        //! A damaged Level is refused before it can be played.
+        if( packChecksum( entry.pHeight, entry.pType, entry.pFaces, cells, entry.pFaces + cells, spanBytes ) != checksum )
+        {
+            mError = path + ": level " + QString::number( index + 1 ) + " fails its checksum";
+            discover();
+            return false;
+        } // if( packChecksum( ... ) != checksum )
+
+        //! Decode the Spans, they must be sorted by cell inside the Level as they are looked up.
+        QByteArray packed = QByteArray::fromRawData( (const char *)entry.pFaces + cells, spanBytes );
+        QDataStream spanStream( packed );
+        Cube::Span previous = { 0, 0, 0, 0 };
+        firstSpans.append( spans.size() );
+
+        for( quint32 s = 0; s < spanCount; s++ )
+        {
+            Cube::Span span;
+            spanStream >> span.cell >> span.type >> span.bottom >> span.top;
+
+            if( span.cell >= cells || span.bottom > span.top || ( s > 0 &&
+                ( span.cell < previous.cell || ( span.cell == previous.cell && span.bottom <= previous.top ) ) ) )
+            {
+                mError = path + ": level " + QString::number( index + 1 ) + " has a Span out of order";
+                discover();
+                return false;
+            } // if( span.cell >= cells || ... )
+
+            spans.append( span );
+            previous = span;
+        } // for( quint32 s = 0; s < spanCount; s++ )
+
+        entries.append( entry );
+    } // for( quint32 index = 0; index < count; index++ )
+
+    //! The Spans are pointed at once they are all decoded and cannot move.
+    mEntries = entries;
+    mSpans   = spans;
+    mCount   = count;
+    mError.clear();
+    account();
+
+    for( quint32 index = 0; index < count; index++ )
+    {
+        if( mEntries[ index ].spanCount != 0 )
+        {
+            mEntries[ index ].pSpans = mSpans.constData() + firstSpans[ index ];
+        } // if( mEntries[ index ].spanCount != 0 )
+    } // for( quint32 index = 0; index < count; index++ )
+
+    return true;
+} // LevelPack::open( const QString & path )
+
+//! Play the Level files of a directory, Level1.lvl, Level2.lvl and so on until one is
+//! missing, parsed when they are loaded so they can be edited while they are played.
+//! Called on the main thread before any Level is loaded, the views of a mapped pack end.
+//! \param path is the directory of the Level files.
+//! \return bool is true on success, else the Level resources are played and error() tells why.
+bool LevelPack::openDirectory( const QString & path )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelPack::openDirectory( const QString & path )...";
+
+    discover();
+
+    uint count = 0;
+
+    while( QFile::exists( path + QString( PACK_DIRECTORY_FILE ).arg( count + 1 ) ) == true )
+    {
+        count++;
+    } // while( QFile::exists( ... ) == true )
+
+    if( count == 0 )
+    {
+        mError = path + ": no Level1.lvl in the level directory";
+        return false;
+    } // if( count == 0 )
+
+    mDirectory = path;
+    mCount     = count;
+    mError.clear();
+
+    return true;
+} // LevelPack::openDirectory( const QString & path )
+
+//! Compile Levels into a level pack file: prepare every Level, find its par with the
+//! Analyzer, then write its cell arrays after the table of contents.
+//! \param path is the level pack file to write.
+//! \param sources are the Level indices, files or resources to pack, in play order.
+//! \param out is the stream to report to.
+//! \return bool is true on success.
+bool LevelPack::write( const QString & path, const QStringList & sources, QTextStream & out )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelPack::write()...";
+
+    if( sources.isEmpty() == true )
+    {
+        out << "No levels to pack" << endl;
+        return false;
+    } // if( sources.isEmpty() == true )
+
+    //! The pack being played is mapped, truncating it would pull the Levels out from under it.
+    LevelPack & pack = instance();
+
+    if( pack.mEntries.isEmpty() == false &&
+        QFileInfo( path ).canonicalFilePath() == QFileInfo( pack.mFile ).canonicalFilePath() )
+    {
+        out << "Unable to overwrite " << path << ", its levels are being played" << endl;
+        return false;
+    } // if( pack.mEntries.isEmpty() == false && ... )
+
+    QFile file( path );
+
+    if( file.open( QIODevice::WriteOnly | QIODevice::Truncate ) == false )
+    {
+        out << "Unable to open " << path << endl;
+        return false;
+    } // if( file.open( QIODevice::WriteOnly | QIODevice::Truncate ) == false )
+
+    //! Leave room for the header and the table of contents, written once the offsets are known.
+    file.write( QByteArray( PACK_HEADER_BYTES + sources.size() * PACK_ENTRY_BYTES, 0 ) );
+
+    QVector< quint64 > offsets;
+    QVector< Entry > entries;
+    Analyzer analyzer;
+
+    foreach( const QString & source, sources )
+    {
+        //! A number selects a Level being played, anything else is a Level file.
+        bool isIndex = false;
+        uint index = source.toUInt( &isIndex );
+
+        Level::Prepared prepared = Level::prepare( isIndex ? index : 0, isIndex ? QString() : source );
+
+        if( prepared.cubeCount == 0 || prepared.pChunks != NULL )
+        {
+            out << "Unable to pack " << source << ", "
+                << ( ( prepared.pChunks != NULL ) ? "a chunk file cannot be packed" : prepared.error ) << endl;
+            Level::release( prepared );
+            return false;
+        } // if( prepared.cubeCount == 0 || prepared.pChunks != NULL )
+
+        int par = analyzer.shortestPath( source );
+
+        //! The Spans are packed in the byte order of the table of contents.
+        QByteArray spans;
+        QDataStream spanStream( &spans, QIODevice::WriteOnly );
+
+        for( uint s = 0; s < prepared.spanCount; s++ )
+        {
+            const Cube::Span & span = prepared.pSpans[ s ];
+            spanStream << span.cell << span.type << span.bottom << span.top;
+        } // for( uint s = 0; s < prepared.spanCount; s++ )
+
+        Entry entry;
+        entry.columns       = prepared.cubeColumns;
+        entry.rows          = prepared.cubeRows;
+        entry.startPosition = prepared.startPosition;
+        entry.par           = ( par < 0 ) ? 0 : par;
+        entry.checksum      = packChecksum( prepared.pCubeHeight, prepared.pCubeType, prepared.pCubeFaces, prepared.cubeCount,
+                                            (const quint8 *)spans.constData(), spans.size() );
+        entry.spanCount     = prepared.spanCount;
+
+        //! The cell arrays are stored as they are used, heights, CubeTypes then visible faces, then the Spans.
+        offsets.append( file.pos() );
+        file.write( (const char *)prepared.pCubeHeight, prepared.cubeCount );
+        file.write( (const char *)prepared.pCubeType, prepared.cubeCount );
+        file.write( (const char *)prepared.pCubeFaces, prepared.cubeCount );
+        file.write( spans );
+        entries.append( entry );
+
+        out << "Packed " << source << ": " << entry.columns << "x" << entry.rows << ", "
+            << entry.spanCount << " spans, par " << entry.par << " moves" << endl;
+
+        Level::release( prepared );
+    } // foreach( const QString & source, sources )
+
+    //! Write the header and the table of contents.
+    file.seek( 0 );
+    QDataStream stream( &file );
+    stream << (quint32)PACK_MAGIC << (quint32)PACK_VERSION << (quint32)entries.size();
+
+    for( int index = 0; index < entries.size(); index++ )
+    {
+        const Entry & entry = entries[ index ];
+
+        stream << offsets[ index ] << (quint32)entry.columns << (quint32)entry.rows
+               << (quint32)entry.startPosition.x() << (quint32)entry.startPosition.y() << (quint32)entry.startPosition.z()
+               << (quint32)entry.par << entry.checksum << (quint32)entry.spanCount;
+    } // for( int index = 0; index < entries.size(); index++ )
+
+    if( stream.status() != QDataStream::Ok || file.error() != QFileDevice::NoError )
+    {
+        out << "Unable to write " << path << endl;
+        return false;
+    } // if( stream.status() != QDataStream::Ok || ... )
+
+    out << "Packed " << entries.size() << " levels into " << path << ", " << file.size() << " bytes" << endl;
+
+    return true;
+} // LevelPack::write( const QString & path, const QStringList & sources, QTextStream & out )
@@ -0,0 +1,133 @@
+/*! \file levelpack.h
+\brief LevelPack class declaration file.
+This file contains the LevelPack class declaration for the application.
+*/
+
+#ifndef LEVELPACK_H
+#define LEVELPACK_H
+
+// QFile header file required for mapping the level pack.
+#include <QFile>
+// QString header file required for the Level names.
+#include <QString>
+// QStringList header file required for the Levels to pack.
+#include <QStringList>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for the table of contents.
+#include <QVector>
+// QVector3D header file required for the start positions.
+#include <QVector3D>
+
+// cube.h header file required for the Spans.
+#include "cube.h"
+
+//! LevelPack class.
+/*!
+This class declaration encapsulates the LevelPack functionality, the Levels the Game plays.
+A level pack is one file holding many compiled Levels: a header, a table of contents with
+the offset, the size, the start position, the par and a checksum of every Level, then the
+cell arrays of the Levels, the heights, the CubeTypes and the visible face masks, ready to
+use, each followed by the Spans of the Level. The pack is mapped once and a Level is a view
+into it, so switching Levels parses and copies nothing. Only the Spans are decoded when the
+pack is opened, as they are stored in the byte order of the table of contents.
+The Levels are discovered when the LevelPack is first used: the pack next to the
+executable if there is one, else the Level resources built into the executable, counted
+until one is missing. Nothing limits the number of Levels at compile time. The Level files
+of a directory can be played instead, so they can be edited while they are played.
+The LevelPack is opened on the main thread before the Levels are played, then only read,
+so any thread can look a Level up.
+*/
+class LevelPack
+{
+public: // Data Types
+    //! A Level of the pack, its cell arrays are views into the mapped pack.
+    struct Entry
+    {
+        //! - Number of Cube columns.
+        uint columns;
+        //! - Number of Cube rows.
+        uint rows;
+        //! - Start location of the Level.
+        QVector3D startPosition;
+        //! - Moves of the shortest path from the start to a finish, zero when none is reachable.
+        uint par;
+        //! - Checksum of the cell arrays.
+        quint32 checksum;
+        //! - Height of the Cube of every cell.
+        const quint8 * pHeight;
+        //! - CubeType of every cell.
+        const quint8 * pType;
+        //! - Mask of the visible faces of every cell.
+        const quint8 * pFaces;
+        //! - Spans sorted by cell, NULL when there are none.
+        const Cube::Span * pSpans;
+        //! - Number of Spans.
+        uint spanCount;
+    }; // struct Entry
+
+public: // Static Functions
+    //! Called to get the LevelPack shared by the process, discovering the Levels on first use.
+    static LevelPack & instance();
+
+    //! Called to compile Levels into a level pack file.
+    static bool write( const QString & path, const QStringList & sources, QTextStream & out );
+
+public: // Access Functions
+    //! Called to get the number of Levels.
+    uint count() const { return mCount; }
+
+    //! Called to get why the last open() or openDirectory() failed.
+    const QString & error() const { return mError; }
+
+public: // Member Functions
+    //! Called to get a Level of the pack, NULL when the Levels are not packed or the index is out of range.
+    const Entry * entry( uint levelIndex ) const;
+
+    //! Called to get the name of a Level, its resource or its place in the pack.
+    QString name( uint levelIndex ) const;
+
+    //! Called to map a level pack and play its Levels.
+    bool open( const QString & path );
+
+    //! Called to play the Level files of a directory.
+    bool openDirectory( const QString & path );
+
+private: // Constructors / Destructors
+    //! LevelPack class constructor.
+    LevelPack();
+
+    //! LevelPack class destructor.
+    ~LevelPack();
+
+private: // Helper Functions
+    //! Called to count the bytes of the decoded Spans in the Memory of the Level arrays.
+    void account();
+
+    //! Called to unmap the pack and count the Level resources instead.
+    void discover();
+
+private: // Member Variables
+    //! Used to map the level pack, closed when the Level resources are played.
+    QFile mFile;
+
+    //! Used to store the Levels of the mapped pack.
+    QVector< Entry > mEntries;
+
+    //! Used to store the Spans of the Levels of the mapped pack.
+    QVector< Cube::Span > mSpans;
+
+    //! Used to store the bytes of the Spans counted in the Memory of the Level arrays.
+    qint64 mAccountedBytes = 0;
+
+    //! Used to store the directory of the Level files played, empty when they are not.
+    QString mDirectory;
+
+    //! Used to store the number of Levels.
+    uint mCount = 0;
+
+    //! Used to store why the last open() or openDirectory() failed.
+    QString mError;
+}; // class LevelPack
+
+#endif // LEVELPACK_H
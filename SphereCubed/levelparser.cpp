@@ -0,0 +1,381 @@
+/*! \file levelparser.cpp
+\brief LevelParser class implementation file.
+This file contains the Level file LevelParser class implementation for the application.
+*/
+
+// levelparser.h header file required for LevelParser class definition.
+#include "levelparser.h"
+
+// algorithm header file required for counting the columns.
+#include <algorithm>
+// cstring header file required for the line end search and the token words.
+#include <cstring>
+
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Most cells of a Level, so the cell index cannot overflow.
+#define LEVEL_PARSER_MAX_CELLS 0x7fffffff
+
+//! Internal test for the white space allowed around the tokens, a carriage return included.
+static inline bool parserSpace( char c )
+{
+    return ( c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f' );
+}
+
+//! Internal value of a hexadecimal digit, -1 for any other character.
+static inline int parserDigit( char c )
+{
+    uint digit = (uchar)c - '0';
+    if( digit < 10 ) { return digit; }
+
+    digit = ( (uchar)c | 0x20 ) - 'a';
+    return ( digit < 6 ) ? (int)digit + 10 : -1;
+}
+
+//! Internal word of the first eight bytes of a token, in the byte order of the machine.
+static quint64 parserWord( const char * pBytes )
+{
+    quint64 word;
+    memcpy( &word, pBytes, sizeof( word ) );
+    return word;
+}
+
+//! Internal mask of the fixed bytes of a 0xTT:0xHH token, the digits are checked one by one.
+static const quint64 TOKEN_MASK = parserWord( "\xFF\xFF\x00\x00\xFF\xFF\xFF\x00" );
+
+//! Internal fixed bytes of a 0xTT:0xHH token.
+static const quint64 TOKEN_PATTERN = parserWord( "0x\x00\x00:0x\x00" );
+
+//! The LevelParser execution begins here.
+//! \param pData is the start of the Level file, it must outlive the LevelParser.
+//! \param size is the number of bytes of the Level file.
+LevelParser::LevelParser( const char * pData, qint64 size ) :
+    mpData( pData ),
+    mpEnd( pData + size )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelParser::LevelParser()...";
+} // LevelParser::LevelParser()
+
+//! The LevelParser execution ends here.
+LevelParser::~LevelParser()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelParser::~LevelParser()...";
+} // LevelParser::~LevelParser()
+
+//! Record an error at a position of the file, with its line and column counted from the start.
+//! \param pAt is the position of the error.
+//! \param message is the error.
+//! \return bool is always false, so a failure can be returned in one statement.
+bool LevelParser::fail( const char * pAt, const QString & message )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelParser::fail()..." << message;
+
+    const char * pLine = mpData;
+    uint line = 1;
+
+    for( const char * p = mpData; p < pAt; p++ )
+    {
+        if( *p == '\n' )
+        {
+            line++;
+            pLine = p + 1;
+        } // if( *p == '\n' )
+    } // for( const char * p = mpData; p < pAt; p++ )
+
+    mError = QString( "line %1, column %2: %3" ).arg( line ).arg( pAt - pLine + 1 ).arg( message );
+    return false;
+} // LevelParser::fail( const char * pAt, const QString & message )
+
+//! Count the rows, a line each, and the columns of the first row, a cell per comma and one.
+//! The line ends are found with memchr(), which the C library searches many bytes at a time.
+//! \return bool is true when the file holds at least one row.
+bool LevelParser::measure()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelParser::measure()...";
+
+    //! Ignore the line ends and spaces after the last row.
+    while( mpEnd > mpData && ( parserSpace( mpEnd[ -1 ] ) || mpEnd[ -1 ] == '\n' ) )
+    {
+        mpEnd--;
+    } // while( mpEnd > mpData && ... )
+
+    if( mpEnd == mpData )
+    {
+        return fail( mpData, "the level file is empty" );
+    } // if( mpEnd == mpData )
+
+    //! Count the rows.
+    mRows = 1;
+    const char * pLineEnd = NULL;
+
+    for( const char * p = mpData; ( p = (const char *)memchr( p, '\n', mpEnd - p ) ) != NULL; p++ )
+    {
+        if( pLineEnd == NULL )
+        {
+            pLineEnd = p;
+        } // if( pLineEnd == NULL )
+
+        mRows++;
+    } // for( const char * p = mpData; ... )
+
+    //! Count the columns of the first row.
+    mColumns = std::count( mpData, ( pLineEnd != NULL ) ? pLineEnd : mpEnd, ',' ) + 1;
+
+    if( (quint64)mColumns * mRows > LEVEL_PARSER_MAX_CELLS )
+    {
+        return fail( mpData, QString( "%1x%2 cells is too many" ).arg( mColumns ).arg( mRows ) );
+    } // if( (quint64)mColumns * mRows > LEVEL_PARSER_MAX_CELLS )
+
+    return true;
+} // LevelParser::measure()
+
+//! Decode every cell into the packed cell arrays, checking every row has the columns of the first.
+//! \param pHeight is the array of the Cube heights, columns() by rows().
+//! \param pType is the array of the CubeTypes, columns() by rows().
+//! \return bool is true when every cell was decoded, else error() tells where the file is malformed.
+bool LevelParser::parse( quint8 * pHeight, quint8 * pType )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "LevelParser::parse()...";
+
+    const char * p = mpData;
+    uint index = 0;
+
+    mSpans.clear();
+
+    //! Go through the rows of Cube.
+    for( uint z = 0; z < mRows; z++ )
+    {
+        uint x = 0;
+
+        //! Go through each Cube in the row.
+        while( true )
+        {
+            const char * pToken = p;
+            uint type   = 0;
+            uint height = 0;
+            bool fast   = false;
+
+            //! Match a token as written eight bytes at a time, then its four digits, unless
+            //! more digits follow.
+            if( mpEnd - p >= 9 && ( parserWord( p ) & TOKEN_MASK ) == TOKEN_PATTERN &&
+                ( mpEnd - p == 9 || parserDigit( p[9] ) < 0 ) )
+            {
+                int typeHigh   = parserDigit( p[2] );
+                int typeLow    = parserDigit( p[3] );
+                int heightHigh = parserDigit( p[7] );
+                int heightLow  = parserDigit( p[8] );
+
+                //! A character that is not a digit has a negative value, one test covers them all.
+                if( ( typeHigh | typeLow | heightHigh | heightLow ) >= 0 )
+                {
+                    type   = ( typeHigh << 4 ) | typeLow;
+                    height = ( heightHigh << 4 ) | heightLow;
+                    p     += 9;
+                    fast   = true;
+                } // if( ( typeHigh | typeLow | heightHigh | heightLow ) >= 0 )
+            } // if( mpEnd - p >= 9 && ... )
+
+            //! Else scan the token byte by byte.
+            if( fast == false )
+            {
+                if( scanByte( p, type, "CubeType" ) == false )
+                {
+                    return false;
+                } // if( scanByte( p, type, "CubeType" ) == false )
+
+                while( p < mpEnd && parserSpace( *p ) ) { p++; }
+
+                if( p == mpEnd || *p != ':' )
+                {
+                    return fail( p, "expected ':' between the CubeType and the height" );
+                } // if( p == mpEnd || *p != ':' )
+
+                p++;
+
+                if( scanByte( p, height, "height" ) == false )
+                {
+                    return false;
+                } // if( scanByte( p, height, "height" ) == false )
+            } // if( fast == false )
+
+            //! A long row would overrun the cell arrays.
+            if( x == mColumns )
+            {
+                return fail( pToken, QString( "the row has more than the %1 cells of the first row" ).arg( mColumns ) );
+            } // if( x == mColumns )
+
+            //! Set the Cube height and CubeType, its column and row are implied by the index.
+            pHeight[ index ] = (quint8)height;
+            pType[ index ]   = (quint8)type;
+            index++;
+
+            //! Check to see if the Cube is the Start position.
+            if( type == Cube::START )
+            {
+                mStartPosition = QVector3D( x, height + 1, z );
+            } // if( type == Cube::START )
+
+            x++;
+
+            //! A comma is followed by another Cube, a line feed or the end of the file ends the row.
+            while( p < mpEnd && parserSpace( *p ) ) { p++; }
+
+            //! The Spans of the cell come first, few cells have any.
+            if( p < mpEnd && *p == '|' && parseSpans( p, index - 1, type, height ) == false )
+            {
+                return false;
+            } // if( p < mpEnd && *p == '|' && ... )
+
+            if( p < mpEnd && *p == ',' )
+            {
+                p++;
+                continue;
+            } // if( p < mpEnd && *p == ',' )
+
+            if( p == mpEnd || *p == '\n' )
+            {
+                break;
+            } // if( p == mpEnd || *p == '\n' )
+
+            return fail( p, "expected ',' or the end of the line" );
+        } // while( true )
+
+        //! A short row would leave cells unset.
+        if( x != mColumns )
+        {
+            return fail( p, QString( "the row has %1 cells, the first row has %2" ).arg( x ).arg( mColumns ) );
+        } // if( x != mColumns )
+
+        //! Step over the line feed.
+        if( p < mpEnd ) { p++; }
+    } // for( uint z = 0; z < mRows; z++ )
+
+    return true;
+} // LevelParser::parse( quint8 * pHeight, quint8 * pType )
+
+//! Scan the Spans following the token of a cell, each |0xTT:0xBB-0xHH, from the bottom up.
+//! A Span is of standard Cubes, above the one below it and clear of the Cube of the cell.
+//! \param p is the position of the first '|', moved past the last Span and the spaces after it.
+//! \param cell is the index of the cell.
+//! \param cellType is the CubeType of the cell.
+//! \param cellHeight is the height of the Cube of the cell.
+//! \return bool is true when the Spans were scanned, else the error is recorded.
+bool LevelParser::parseSpans( const char * & p, uint cell, uint cellType, uint cellHeight )
+{
+    int below = -1;
+
+    while( p < mpEnd && *p == '|' )
+    {
+        const char * pSpan = p;
+        uint type   = 0;
+        uint bottom = 0;
+        uint top    = 0;
+
+        p++;
+
+        if( scanByte( p, type, "Span CubeType" ) == false )
+        {
+            return false;
+        } // if( scanByte( p, type, "Span CubeType" ) == false )
+
+        while( p < mpEnd && parserSpace( *p ) ) { p++; }
+
+        if( p == mpEnd || *p != ':' )
+        {
+            return fail( p, "expected ':' between the CubeType and the heights of the Span" );
+        } // if( p == mpEnd || *p != ':' )
+
+        p++;
+
+        if( scanByte( p, bottom, "Span bottom" ) == false )
+        {
+            return false;
+        } // if( scanByte( p, bottom, "Span bottom" ) == false )
+
+        while( p < mpEnd && parserSpace( *p ) ) { p++; }
+
+        if( p == mpEnd || *p != '-' )
+        {
+            return fail( p, "expected '-' between the bottom and the top of the Span" );
+        } // if( p == mpEnd || *p != '-' )
+
+        p++;
+
+        if( scanByte( p, top, "Span top" ) == false )
+        {
+            return false;
+        } // if( scanByte( p, top, "Span top" ) == false )
+
+        if( type != Cube::STANDARD )
+        {
+            return fail( pSpan, "a Span must be of standard Cubes" );
+        } // if( type != Cube::STANDARD )
+
+        if( bottom > top || (int)bottom <= below )
+        {
+            return fail( pSpan, "the Span must be above the Span before it, its bottom no higher than its top" );
+        } // if( bottom > top || (int)bottom <= below )
+
+        if( cellType != Cube::HOLE && cellHeight >= bottom && cellHeight <= top )
+        {
+            return fail( pSpan, "the Span overlaps the Cube of the cell" );
+        } // if( cellType != Cube::HOLE && ... )
+
+        Cube::Span span;
+        span.cell   = cell;
+        span.type   = (quint8)type;
+        span.bottom = (quint8)bottom;
+        span.top    = (quint8)top;
+        mSpans.append( span );
+
+        below = top;
+
+        while( p < mpEnd && parserSpace( *p ) ) { p++; }
+    } // while( p < mpEnd && *p == '|' )
+
+    return true;
+} // LevelParser::parseSpans( const char * & p, uint cell, uint cellType, uint cellHeight )
+
+//! Scan a hexadecimal byte, with spaces before it and an optional 0x prefix.
+//! \param p is the position to scan from, moved past the byte.
+//! \param value is set to the byte.
+//! \param pWhat names the byte in the error.
+//! \return bool is true when a byte was scanned, else the error is recorded.
+bool LevelParser::scanByte( const char * & p, uint & value, const char * pWhat )
+{
+    while( p < mpEnd && parserSpace( *p ) ) { p++; }
+
+    const char * pStart = p;
+
+    //! Skip the optional prefix.
+    if( mpEnd - p >= 2 && p[0] == '0' && ( p[1] | 0x20 ) == 'x' )
+    {
+        p += 2;
+    } // if( mpEnd - p >= 2 && ... )
+
+    //! Accumulate the digits, failing as soon as the value does not fit a byte.
+    const char * pDigits = p;
+    value = 0;
+
+    while( p < mpEnd && parserDigit( *p ) >= 0 )
+    {
+        value = ( value << 4 ) | parserDigit( *p );
+        p++;
+
+        if( value > 0xFF )
+        {
+            return fail( pStart, QString( "the %1 is more than 0xFF" ).arg( pWhat ) );
+        } // if( value > 0xFF )
+    } // while( p < mpEnd && parserDigit( *p ) >= 0 )
+
+    if( p == pDigits )
+    {
+        return fail( pStart, QString( "expected the hexadecimal %1" ).arg( pWhat ) );
+    } // if( p == pDigits )
+
+    return true;
+} // LevelParser::scanByte( const char * & p, uint & value, const char * pWhat )
@@ -0,0 +1,100 @@
+/*! \file levelparser.h
+\brief LevelParser class declaration file.
+This file contains the Level file LevelParser class declaration for the application.
+*/
+
+#ifndef LEVELPARSER_H
+#define LEVELPARSER_H
+
+// QString header file required for the error message.
+#include <QString>
+// QVector header file required for the Spans.
+#include <QVector>
+// QVector3D header file required for the start position.
+#include <QVector3D>
+
+// cube.h header file required for the Spans.
+#include "cube.h"
+
+//! LevelParser class.
+/*!
+This class declaration encapsulates the text Level file LevelParser functionality.
+A Level file has a line per row of cells, each cell a 0xTT:0xHH token of its CubeType and
+height in hexadecimal, separated by commas. The parser scans the file where it lies, mapped
+or read in one piece, and nothing is allocated per cell: the rows are counted with a
+memchr() search for the line ends, so the cell arrays can be allocated up front, then every
+token is decoded straight into them. The tokens as written, fixed width with lower or upper
+case digits, are matched eight bytes at a time, any other spelling the old parser took,
+with spaces or fewer digits, falls back to a byte by byte scan.
+A cell token can be followed by the Spans of the cell, Cubes stacked apart from the Cube
+of the cell, each a |0xTT:0xBB-0xHH of its CubeType and the heights of its lowest and
+highest Cube, from the bottom up. Only the cells with Spans take memory for them.
+A malformed file is reported with the line and column of the first error instead of
+asserting.
+*/
+class LevelParser
+{
+public: // Constructors / Destructors
+    //! LevelParser class constructor.
+    LevelParser( const char * pData, qint64 size );
+
+    //! LevelParser class destructor.
+    ~LevelParser();
+
+public: // Access Functions
+    //! Called to get the number of Cube columns found by measure().
+    uint columns() const { return mColumns; }
+
+    //! Called to get the error of the last failed call, as line:column: message.
+    const QString & error() const { return mError; }
+
+    //! Called to get the number of Cube rows found by measure().
+    uint rows() const { return mRows; }
+
+    //! Called to get the Spans found by parse(), in the order of their cells, from the bottom up.
+    const QVector< Cube::Span > & spans() const { return mSpans; }
+
+    //! Called to get the start position found by parse().
+    const QVector3D & startPosition() const { return mStartPosition; }
+
+public: // Member Functions
+    //! Called to count the rows and the columns of the first row.
+    bool measure();
+
+    //! Called to decode every cell into the packed cell arrays, columns() by rows() each.
+    bool parse( quint8 * pHeight, quint8 * pType );
+
+private: // Helper Functions
+    //! Called to record an error at a position of the file.
+    bool fail( const char * pAt, const QString & message );
+
+    //! Called to scan the Spans following the token of a cell.
+    bool parseSpans( const char * & p, uint cell, uint cellType, uint cellHeight );
+
+    //! Called to scan a hexadecimal byte with an optional 0x prefix, the slow path.
+    bool scanByte( const char * & p, uint & value, const char * pWhat );
+
+private: // Member Variables
+    //! Used to store the start of the file.
+    const char * mpData;
+
+    //! Used to store the end of the file, past the last row.
+    const char * mpEnd;
+
+    //! Used to store the number of Cube columns.
+    uint mColumns = 0;
+
+    //! Used to store the number of Cube rows.
+    uint mRows = 0;
+
+    //! Used to store the start location of the Level.
+    QVector3D mStartPosition;
+
+    //! Used to store the Spans, empty unless a cell has any.
+    QVector< Cube::Span > mSpans;
+
+    //! Used to store the error of the last failed call.
+    QString mError;
+}; // class LevelParser
+
+#endif // LEVELPARSER_H
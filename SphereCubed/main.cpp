@@ -5,7 +5,33 @@ This file contains SphereCubed application entry point.
 
 // QApplication header required execution.
 #include <QApplication>
+// QCommandLineParser header required for command line modes.
+#include <QCommandLineParser>
+// QTextStream header required for reporting invalid options.
+#include <QTextStream>
 
+// analyzer.h header required for the level analyzer mode.
+#include "analyzer.h"
+// benchmark.h header required for the benchmark mode.
+#include "benchmark.h"
+// chunkbenchmark.h header required for the chunk file benchmark mode.
+#include "chunkbenchmark.h"
+// cyclebenchmark.h header required for the level cycle benchmark mode.
+#include "cyclebenchmark.h"
+// dispatchbenchmark.h header required for the state machine dispatch benchmark mode.
+#include "dispatchbenchmark.h"
+// generator.h header required for the level generator mode.
+#include "generator.h"
+// levelpack.h header required for the level pack modes.
+#include "levelpack.h"
+// regression.h header required for the golden trajectory mode.
+#include "regression.h"
+// supportcheck.h header required for the support query verification mode.
+#include "supportcheck.h"
+// options.h header required for run time options.
+#include "options.h"
+// settings.h header required for default settings.
+#include "settings.h"
 // Window.h header required for the UI.
 #include "window.h"
 
@@ -21,8 +47,205 @@ int main( int argc, char * argv[] )
     //! Instantiate the QApplication object passing on the entry point arguments.
     QApplication app( argc, argv );
 
+    //! Describe the command line modes.
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Sphere Cubed" );
+    parser.addHelpOption();
+
+    QCommandLineOption latencyOption( "latency", "Measure and report the input to display latency." );
+    parser.addOption( latencyOption );
+
+    QCommandLineOption statsOption( "stats", "Report the frame pacer, physics, level arena and chunk, job system and memory statistics on exit." );
+    parser.addOption( statsOption );
+
+    QCommandLineOption tickRateOption( "tick-rate", "Target game ticks per second, rounded to a whole mS interval.", "hz", QString::number( ENGINE_TICK_RATE ) );
+    parser.addOption( tickRateOption );
+
+    QCommandLineOption threadedOption( "threaded", "Run the physics on its own simulation thread." );
+    parser.addOption( threadedOption );
+
+    QCommandLineOption levelPackOption( "level-pack", "Play the levels of a level pack <file> instead of the shipped levels.", "file" );
+    parser.addOption( levelPackOption );
+
+    QCommandLineOption levelDirOption( "level-dir", "Play the Level<n>.lvl files of <directory>, reloaded whenever they are saved.", "directory" );
+    parser.addOption( levelDirOption );
+
+    QCommandLineOption analyzeOption( "analyze", "Analyze the reachability of a level index or level file.", "level" );
+    parser.addOption( analyzeOption );
+
+    QCommandLineOption benchmarkOption( "benchmark", "Render a camera flythrough of <level> offscreen and report frame times.", "level" );
+    parser.addOption( benchmarkOption );
+
+    QCommandLineOption framesOption( "frames", "Number of benchmark frames to render.", "frames", QString::number( BENCHMARK_FRAME_COUNT ) );
+    parser.addOption( framesOption );
+
+    QCommandLineOption chunkBenchmarkOption( "chunk-benchmark", "Report the compression of a chunk <file> and time its cell lookups.", "file" );
+    parser.addOption( chunkBenchmarkOption );
+
+    QCommandLineOption lookupsOption( "lookups", "Number of chunk benchmark cell lookups.", "lookups", QString::number( CHUNK_BENCHMARK_LOOKUPS ) );
+    parser.addOption( lookupsOption );
+
+    QCommandLineOption cycleOption( "cycle-benchmark", "Time <cycles> level loads and unloads and report the heap blocks taken.", "cycles" );
+    parser.addOption( cycleOption );
+
+    QCommandLineOption dispatchOption( "dispatch-benchmark", "Compare the state machine dispatch cost over <ticks> ticks.", "ticks" );
+    parser.addOption( dispatchOption );
+
+    QCommandLineOption generateOption( "generate", "Generate a level and write it to <file>.", "file" );
+    parser.addOption( generateOption );
+
+    QCommandLineOption chunkedOption( "chunked", "Write the generated level as a chunk file, read on demand when played." );
+    parser.addOption( chunkedOption );
+
+    QCommandLineOption columnsOption( "columns", "Generated level width in cubes.", "columns", QString::number( GENERATOR_COLUMNS ) );
+    parser.addOption( columnsOption );
+
+    QCommandLineOption rowsOption( "rows", "Generated level depth in cubes.", "rows", QString::number( GENERATOR_ROWS ) );
+    parser.addOption( rowsOption );
+
+    QCommandLineOption holesOption( "holes", "Generated level hole density from 0 to 1.", "density", QString::number( GENERATOR_HOLE_DENSITY ) );
+    parser.addOption( holesOption );
+
+    QCommandLineOption varianceOption( "variance", "Generated level maximum cube height.", "height", QString::number( GENERATOR_HEIGHT_VARIANCE ) );
+    parser.addOption( varianceOption );
+
+    QCommandLineOption seedOption( "seed", "Generated level seed.", "seed", "1" );
+    parser.addOption( seedOption );
+
+    QCommandLineOption packOption( "pack", "Compile the given level files, or the levels played, into a level pack <file>.", "file" );
+    parser.addOption( packOption );
+    parser.addPositionalArgument( "levels", "Level indices or level files to pack.", "[levels...]" );
+
+    QCommandLineOption goldenOption( "golden", "Verify the physics against the golden trajectories in <directory>.", "directory" );
+    parser.addOption( goldenOption );
+
+    QCommandLineOption recordGoldenOption( "record-golden", "Record the golden trajectories into <directory>.", "directory" );
+    parser.addOption( recordGoldenOption );
+
+    QCommandLineOption ulpOption( "ulp", "Golden trajectory tolerance in units in the last place.", "ulp", QString::number( GOLDEN_ULP_TOLERANCE ) );
+    parser.addOption( ulpOption );
+
+    QCommandLineOption verifySupportOption( "verify-support", "Compare the cached support query with the cube search over <positions> random positions per level.", "positions" );
+    parser.addOption( verifySupportOption );
+
+    parser.process( app );
+
+    //! Play the Levels of a level pack, every mode below uses them.
+    if( parser.isSet( levelPackOption ) && LevelPack::instance().open( parser.value( levelPackOption ) ) == false )
+    {
+        QTextStream( stderr ) << LevelPack::instance().error() << endl;
+        return 1;
+    } // if( parser.isSet( levelPackOption ) && ... )
+
+    //! Play the Level files of a directory, so they can be edited while they are played.
+    if( parser.isSet( levelDirOption ) && LevelPack::instance().openDirectory( parser.value( levelDirOption ) ) == false )
+    {
+        QTextStream( stderr ) << LevelPack::instance().error() << endl;
+        return 1;
+    } // if( parser.isSet( levelDirOption ) && ... )
+
+    //! Analyze a level and exit.
+    if( parser.isSet( analyzeOption ) )
+    {
+        Analyzer analyzer;
+        return analyzer.analyze( parser.value( analyzeOption ) );
+    }
+
+    //! Run the rendering benchmark and exit.
+    if( parser.isSet( benchmarkOption ) )
+    {
+        Benchmark benchmark;
+        return benchmark.run( parser.value( benchmarkOption ).toUInt(), parser.value( framesOption ).toUInt() );
+    }
+
+    //! Run the chunk file benchmark and exit.
+    if( parser.isSet( chunkBenchmarkOption ) )
+    {
+        ChunkBenchmark chunkBenchmark;
+        return chunkBenchmark.run( parser.value( chunkBenchmarkOption ), parser.value( lookupsOption ).toUInt() );
+    }
+
+    //! Run the level cycle benchmark and exit.
+    if( parser.isSet( cycleOption ) )
+    {
+        CycleBenchmark cycleBenchmark;
+        return cycleBenchmark.run( parser.value( cycleOption ).toUInt() );
+    }
+
+    //! Run the state machine dispatch benchmark and exit.
+    if( parser.isSet( dispatchOption ) )
+    {
+        DispatchBenchmark dispatchBenchmark;
+        return dispatchBenchmark.run( parser.value( dispatchOption ).toUInt() );
+    }
+
+    //! Generate a level and exit.
+    if( parser.isSet( generateOption ) )
+    {
+        Generator generator( parser.value( columnsOption ).toUInt(),
+                             parser.value( rowsOption ).toUInt(),
+                             parser.value( holesOption ).toFloat(),
+                             parser.value( varianceOption ).toUInt(),
+                             parser.value( seedOption ).toUInt() );
+        return generator.write( parser.value( generateOption ), parser.isSet( chunkedOption ) );
+    }
+
+    //! Compile a level pack and exit.
+    if( parser.isSet( packOption ) )
+    {
+        //! Without level files the levels played are packed, so a pack can be rebuilt after a change.
+        QStringList levels = parser.positionalArguments();
+        if( levels.isEmpty() )
+        {
+            for( uint levelIndex = 1; levelIndex <= LevelPack::instance().count(); levelIndex++ )
+            {
+                levels.append( QString::number( levelIndex ) );
+            }
+        }
+
+        QTextStream out( stdout );
+        return LevelPack::write( parser.value( packOption ), levels, out ) ? 0 : 1;
+    }
+
+    //! Record the golden trajectories and exit.
+    if( parser.isSet( recordGoldenOption ) )
+    {
+        Regression regression( ENGINE_TICK_INTERVAL );
+        return regression.record( parser.value( recordGoldenOption ) );
+    }
+
+    //! Verify the golden trajectories and exit.
+    if( parser.isSet( goldenOption ) )
+    {
+        Regression regression( ENGINE_TICK_INTERVAL );
+        return regression.verify( parser.value( goldenOption ), parser.value( ulpOption ).toLongLong() );
+    }
+
+    //! Verify the cached support query and exit.
+    if( parser.isSet( verifySupportOption ) )
+    {
+        SupportCheck supportCheck;
+        return supportCheck.run( parser.value( verifySupportOption ).toUInt() );
+    }
+
+    //! Collect the run time options.
+    Options options;
+    options.latency = parser.isSet( latencyOption );
+    options.stats = parser.isSet( statsOption );
+
+    //! Convert the tick rate into a whole mS interval, the Physics steps whole mS.
+    bool ok;
+    int tickRate = parser.value( tickRateOption ).toInt( &ok );
+    if( ok == false || tickRate < 1 || tickRate > 1000 )
+    {
+        QTextStream( stderr ) << "Invalid tick rate " << parser.value( tickRateOption ) << ", expected 1 to 1000" << endl;
+        return 1;
+    } // if( ok == false || tickRate < 1 || tickRate > 1000 )
+    options.tickInterval = qRound( 1000.0 / tickRate );
+    options.threaded = parser.isSet( threadedOption );
+
     //! Instantiate the Window object.
-    Window win;
+    Window win( options );
 
     //! Show the Sphere Cubed application window.
     win.show();
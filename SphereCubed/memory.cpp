@@ -0,0 +1,120 @@
+/*! \file memory.cpp
+\brief Memory class implementation file.
+This file contains the Memory accounting class implementation for the application.
+*/
+
+// memory.h header file required for Memory class definition.
+#include "memory.h"
+
+// QOpenGLTexture header file required for the texture sizes.
+#include <QOpenGLTexture>
+
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Bytes of a texel of an OpenGL texture made from an image, RGBA with 8 bits each.
+#define MEMORY_TEXEL_BYTES 4
+
+//! Name of each subsystem in the report.
+static const char * const MEMORY_SUBSYSTEM_NAME[ Memory::SUBSYSTEM_COUNT ] =
+{
+    "level arrays", "level chunks", "arena pool", "gpu buffers", "texture images", "texture gpu", "state machines"
+};
+
+//! The Memory execution begins here.
+Memory::Memory()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Memory::Memory()...";
+} // Memory::Memory()
+
+//! The Memory execution ends here.
+Memory::~Memory()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Memory::~Memory()...";
+} // Memory::~Memory()
+
+//! Counters constructor, every counter starts at zero.
+Memory::Counters::Counters()
+{
+    for( int subsystem = 0; subsystem < SUBSYSTEM_COUNT; subsystem++ )
+    {
+        count[ subsystem ] = 0;
+        bytes[ subsystem ] = 0;
+        peak[ subsystem ]  = 0;
+    } // for( int subsystem = 0; subsystem < SUBSYSTEM_COUNT; subsystem++ )
+} // Memory::Counters::Counters()
+
+//! Count an allocation of a subsystem, raising its peak.
+//! \param subsystem is the subsystem allocating.
+//! \param bytes is the number of bytes allocated.
+//! \return void
+void Memory::allocated( Subsystem subsystem, qint64 bytes )
+{
+    Counters & shared = counters();
+    shared.count[ subsystem ]++;
+    qint64 held = ( shared.bytes[ subsystem ] += bytes );
+    qint64 peak = shared.peak[ subsystem ].load();
+    while( held > peak && shared.peak[ subsystem ].compare_exchange_weak( peak, held ) == false ) {}
+} // Memory::allocated( Subsystem subsystem, qint64 bytes )
+
+//! Get the counters shared by the process, created on first use.
+//! \return Counters & is the counters.
+Memory::Counters & Memory::counters()
+{
+    static Counters shared;
+    return shared;
+} // Memory::counters()
+
+//! Count an allocation of a subsystem given back, the bytes counted when it was allocated.
+//! \param subsystem is the subsystem freeing.
+//! \param bytes is the number of bytes freed.
+//! \return void
+void Memory::freed( Subsystem subsystem, qint64 bytes )
+{
+    Counters & shared = counters();
+    shared.count[ subsystem ]--;
+    shared.bytes[ subsystem ] -= bytes;
+} // Memory::freed( Subsystem subsystem, qint64 bytes )
+
+//! Report the allocations, bytes and peak bytes held by every subsystem, then their total.
+//! \param out is the stream to report to.
+//! \return void
+void Memory::report( QTextStream & out )
+{
+    Counters & shared = counters();
+    qint64 total = 0;
+
+    for( int subsystem = 0; subsystem < SUBSYSTEM_COUNT; subsystem++ )
+    {
+        qint64 held = shared.bytes[ subsystem ].load();
+        total += held;
+
+        out << "memory: " << MEMORY_SUBSYSTEM_NAME[ subsystem ] << " " << held << " bytes in "
+            << shared.count[ subsystem ].load() << ", peak " << shared.peak[ subsystem ].load() << " bytes" << endl;
+    } // for( int subsystem = 0; subsystem < SUBSYSTEM_COUNT; subsystem++ )
+
+    out << "memory: total " << total << " bytes" << endl;
+} // Memory::report( QTextStream & out )
+
+//! Get the bytes of an OpenGL texture, every mipmap level halving the one above.
+//! Called before the texture is destroyed, which forgets its size.
+//! \param texture is the texture.
+//! \return qint64 is the number of bytes.
+qint64 Memory::textureBytes( const QOpenGLTexture & texture )
+{
+    qint64 bytes  = 0;
+    qint64 width  = texture.width();
+    qint64 height = texture.height();
+
+    for( int level = 0; level < qMax( 1, texture.mipLevels() ); level++ )
+    {
+        bytes += width * height * MEMORY_TEXEL_BYTES;
+        width  = qMax( Q_INT64_C( 1 ), width / 2 );
+        height = qMax( Q_INT64_C( 1 ), height / 2 );
+    } // for( int level = 0; level < qMax( 1, texture.mipLevels() ); level++ )
+
+    return bytes;
+} // Memory::textureBytes( const QOpenGLTexture & texture )
@@ -0,0 +1,88 @@
+/*! \file memory.h
+\brief Memory class declaration file.
+This file contains the Memory accounting class declaration for the application.
+*/
+
+#ifndef MEMORY_H
+#define MEMORY_H
+
+// QTextStream header file required for reporting.
+#include <QTextStream>
+
+// atomic header file required for the counters.
+#include <atomic>
+
+// Pre-declared class
+class QOpenGLTexture;
+
+//! Memory class.
+/*!
+This class declaration encapsulates the Memory accounting functionality.
+Every subsystem that holds memory for long, the Level Arenas, the resident chunks, the
+pooled Arenas, the OpenGL buffers and textures and the state machines, counts the bytes it
+takes and gives back, so the memory of each subsystem can be reported while the Game runs,
+to tell which one to shrink. The OpenGL memory is the size requested from the driver, a
+texture is counted as four bytes a texel over all of its mipmaps. A decoded texture image
+is only held while it is uploaded, its peak is the one to watch.
+The counters are atomic, any thread can count.
+*/
+class Memory
+{
+public: // Data Types
+    //! Enumeration of the subsystems whose memory is counted.
+    enum Subsystem
+    {
+        LEVEL_ARRAYS = 0, //!< - Level Arenas, the cell arrays, the Spans and the culling results, and the level pack Spans.
+        LEVEL_CHUNKS,     //!< - Resident chunks of a chunked Level.
+        ARENA_POOL,       //!< - Reset Arenas kept in the pool for the next Level.
+        GPU_BUFFERS,      //!< - OpenGL vertex buffers of the Cube faces, the Sphere and the Menu.
+        TEXTURE_IMAGES,   //!< - Decoded texture images, held while they are uploaded.
+        TEXTURE_GPU,      //!< - OpenGL textures with their mipmaps.
+        STATE_MACHINES,   //!< - StaticMachines with their States.
+        SUBSYSTEM_COUNT   //!< - Number of subsystems.
+    }; // enum Subsystem
+
+public: // Static Functions
+    //! Called on any thread to count an allocation of a subsystem.
+    static void allocated( Subsystem subsystem, qint64 bytes );
+
+    //! Called on any thread to get the bytes held by a subsystem.
+    static qint64 bytes( Subsystem subsystem ) { return counters().bytes[ subsystem ].load(); }
+
+    //! Called on any thread to count an allocation of a subsystem given back.
+    static void freed( Subsystem subsystem, qint64 bytes );
+
+    //! Called to report the bytes held by every subsystem.
+    static void report( QTextStream & out );
+
+    //! Called to get the bytes of an OpenGL texture with its mipmaps.
+    static qint64 textureBytes( const QOpenGLTexture & texture );
+
+private: // Constructors / Destructors
+    //! Memory class constructor.
+    Memory();
+
+    //! Memory class destructor.
+    ~Memory();
+
+private: // Data Types
+    //! Internal counters shared by the process.
+    struct Counters
+    {
+        //! - Number of allocations held by each subsystem.
+        std::atomic< qint64 > count[ SUBSYSTEM_COUNT ];
+        //! - Number of bytes held by each subsystem.
+        std::atomic< qint64 > bytes[ SUBSYSTEM_COUNT ];
+        //! - Most bytes held by each subsystem at once.
+        std::atomic< qint64 > peak[ SUBSYSTEM_COUNT ];
+
+        //! Counters constructor.
+        Counters();
+    }; // struct Counters
+
+private: // Helper Functions
+    //! Called to get the counters shared by the process.
+    static Counters & counters();
+}; // class Memory
+
+#endif // MEMORY_H
@@ -17,6 +17,8 @@ This file contains the Menu class implementation for the application.
 // QVector3D header file required for vertices.
 #include <QVector3D>
 
+// memory.h header file required for counting the OpenGL buffer and texture.
+#include "memory.h"
 // trace.h header file required for tracing execution.
 #include "trace.h"
 
@@ -53,6 +55,7 @@ Menu::~Menu()
     if( mpTexture != NULL )
     {
         //! Release the allocated memory.
+        Memory::freed( Memory::TEXTURE_GPU, Memory::textureBytes( *mpTexture ) );
         delete mpTexture;
         //! Set memory pointer to null.
         mpTexture = NULL;
@@ -142,6 +145,7 @@ void Menu::load( QString imageName )
 
     //! Allocate memory for the buffer.
     mBuffer.allocate(4 * (3+2) * sizeof(GLfloat));
+    Memory::allocated( Memory::GPU_BUFFERS, 4 * (3+2) * sizeof(GLfloat) );
 
     //! Track the data offset, the vertex data starts first at zero.
     int offset = 0;
@@ -170,8 +174,11 @@ void Menu::load( QString imageName )
         return;
     } // if( image.isNull() == true )
 
-    //! Convert the image to an OpenGL texture.
+    //! Convert the image to an OpenGL texture, the decoded image is held until it is uploaded.
+    Memory::allocated( Memory::TEXTURE_IMAGES, image.byteCount() );
     mpTexture = new QOpenGLTexture(image);
+    Memory::freed( Memory::TEXTURE_IMAGES, image.byteCount() );
+    Memory::allocated( Memory::TEXTURE_GPU, Memory::textureBytes( *mpTexture ) );
 } // Menu::load( QString imageName )
 
 //! Render the Menu from the view point of the Camera.
@@ -265,6 +272,7 @@ void Menu::unload()
     if( mpTexture != NULL )
     {
         //! release the allocated memory.
+        Memory::freed( Memory::TEXTURE_GPU, Memory::textureBytes( *mpTexture ) );
         delete mpTexture;
         //! set the memory pointer to null.
         mpTexture = NULL;
@@ -274,5 +282,10 @@ void Menu::unload()
     mProgram.removeAllShaders();
 
     //! Destroy the OpenGL buffer.
+    if( mBuffer.isCreated() == true )
+    {
+        Memory::freed( Memory::GPU_BUFFERS, 4 * (3+2) * sizeof(GLfloat) );
+    } // if( mBuffer.isCreated() == true )
+
     mBuffer.destroy();
 } // Menu::unload()
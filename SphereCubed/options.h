@@ -0,0 +1,32 @@
+/*! \file options.h
+\brief Options structure declaration file.
+This file contains the command line Options structure for the application.
+*/
+
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+// settings.h header file required for the default tick interval.
+#include "settings.h"
+
+//! Options structure.
+/*!
+This structure declaration holds the run time options selected on the command line.
+main() fills it in and the Window passes it on to the Engine.
+*/
+struct Options
+{
+    //! Used to enable the input to display latency measurement, initialized to false.
+    bool latency = false;
+
+    //! Used to report the frame Pacer and Jobs system statistics on exit, initialized to false.
+    bool stats = false;
+
+    //! Used to store the Engine tick interval in mS, initialized to the default tick rate.
+    int tickInterval = ENGINE_TICK_INTERVAL;
+
+    //! Used to run the Physics on its own Simulation thread, initialized to false.
+    bool threaded = false;
+}; // struct Options
+
+#endif // OPTIONS_H
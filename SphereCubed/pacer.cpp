@@ -0,0 +1,121 @@
+/*! \file pacer.cpp
+\brief Pacer class implementation file.
+This file contains the frame Pacer class implementation for the application.
+*/
+
+// pacer.h header file required for Pacer class definition.
+#include "pacer.h"
+
+// chrono header file required for the monotonic deadlines.
+#include <chrono>
+
+// settings.h header file required for the catch up limit.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The Pacer execution begins here.
+//! Automatically called by the Engine during construction.
+//! \param timeInterval is the tick interval in mS.
+//! \param parent is a pointer the QObject parent object.
+Pacer::Pacer( int timeInterval, QObject * parent ) :
+    QObject( parent ),
+    mInterval( timeInterval * Q_INT64_C( 1000000 ) )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Pacer::Pacer()...";
+
+    //! Fire once per arming, as close to the requested time as the platform allows.
+    mTimer.setSingleShot( true );
+    mTimer.setTimerType( Qt::PreciseTimer );
+
+    connect( &mTimer, &QTimer::timeout, this, &Pacer::expired );
+} // Pacer::Pacer()
+
+//! The Pacer execution ends here.
+//! Automatically called when the Engine is destructed.
+Pacer::~Pacer()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Pacer::~Pacer()...";
+} // Pacer::~Pacer()
+
+//! Emit the ticks that are due and arm the timer for the next deadline.
+//! \return void
+void Pacer::expired()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Pacer::expired()...";
+
+    qint64 time = now();
+
+    //! If the timer fired early, wait for the rest of the interval.
+    if( time < mDeadline )
+    {
+        schedule();
+        return;
+    } // if( time < mDeadline )
+
+    //! Count the ticks whose deadlines have passed.
+    qint64 late = time - mDeadline;
+    qint64 due = late / mInterval + 1;
+    mMaxLate = qMax( mMaxLate, late );
+
+    //! Every deadline passed before the previous tick ran is a missed deadline.
+    if( due > 1 )
+    {
+        mMissed += due - 1;
+        TraceOut( TRACE_FILE_EXECUTION ) << "Pacer::expired() - missed" << due - 1 << "deadlines...";
+    } // if( due > 1 )
+
+    //! Catch up on a limited number of ticks, far behind the rest are dropped.
+    qint64 count = qMin( due, (qint64)PACER_CATCH_UP_TICKS );
+    mDropped += due - count;
+    mTicks += count;
+
+    //! Arm the timer for the next deadline before the ticks run, so their time does not delay it.
+    mDeadline += due * mInterval;
+    schedule();
+
+    emit tick( (uint)count );
+} // Pacer::expired()
+
+//! Get the monotonic time stamp the deadlines are kept in.
+//! \return qint64 is the time in nanoseconds.
+qint64 Pacer::now()
+{
+    return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+} // Pacer::now()
+
+//! Report the tick and missed deadline counts.
+//! \param out is the stream to report to.
+//! \return void
+void Pacer::report( QTextStream & out )
+{
+    qint64 elapsed = now() - mStarted;
+
+    out << "pacer: " << mTicks << " ticks in " << elapsed / 1000000 << " mS at "
+        << QString::number( 1000000000.0 / mInterval, 'f', 1 ) << " Hz target, "
+        << mMissed << " missed deadlines, " << mDropped << " dropped ticks, max late "
+        << QString::number( mMaxLate / 1000000.0, 'f', 2 ) << " mS" << endl;
+} // Pacer::report( QTextStream & out )
+
+//! Arm the timer for the next deadline, rounded up to the timer millisecond resolution.
+//! \return void
+void Pacer::schedule()
+{
+    qint64 remaining = qMax( Q_INT64_C( 0 ), mDeadline - now() );
+
+    mTimer.start( (int)( ( remaining + 999999 ) / 1000000 ) );
+} // Pacer::schedule()
+
+//! Start ticking, the first deadline is one interval from now.
+//! \return void
+void Pacer::start()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Pacer::start()...";
+
+    mStarted = now();
+    mDeadline = mStarted + mInterval;
+    schedule();
+} // Pacer::start()
@@ -0,0 +1,90 @@
+/*! \file pacer.h
+\brief Pacer class declaration file.
+This file contains the frame Pacer class declaration for the application.
+*/
+
+#ifndef PACER_H
+#define PACER_H
+
+// QObject header file required for signals.
+#include <QObject>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QTimer header file required for the precise single shot timer.
+#include <QTimer>
+
+//! Pacer class.
+/*!
+This class declaration encapsulates the frame Pacer functionality.
+The Physics advances a fixed time interval every tick, so the ticks must keep up with
+real time. A coarse repeating Qt timer coalesces and drifts, so the Pacer keeps absolute
+tick deadlines on the monotonic steady clock and re-arms a single shot Qt::PreciseTimer
+for the next one each time. A tick that fires late is followed at once by the ticks it
+missed, up to a limit, so the game keeps real time under load, and the missed deadlines
+are counted for the report.
+*/
+class Pacer : public QObject
+{
+    // Q_OBJECT macro required to use services provided by Qt's meta-object system.
+    Q_OBJECT
+
+    //! Friend of Engine so that only Engine can instantiate the Pacer.
+    friend class Engine;
+
+public: // Member Functions
+    //! Called to report the tick and missed deadline counts.
+    void report( QTextStream & out );
+
+    //! Called to start ticking, the first tick is one interval from now.
+    void start();
+
+signals:
+    //! Emitted when tick deadlines have been reached.
+    //! \param count is the number of ticks due, more than one when catching up.
+    //! \return void
+    void tick( uint count );
+
+private: // Constructors / Destructors
+    //! Pacer class constructor.
+    explicit Pacer( int timeInterval, QObject * parent = 0 );
+
+    //! Pacer class destructor.
+    ~Pacer();
+
+private: // Helper Functions
+    //! Called when the timer expires to emit the ticks that are due.
+    void expired();
+
+    //! Called to get the monotonic time stamp deadlines are kept in, in nanoseconds.
+    static qint64 now();
+
+    //! Called to arm the timer for the next deadline.
+    void schedule();
+
+private: // Member Variables
+    //! Used to fire at the next deadline.
+    QTimer mTimer;
+
+    //! Used to store the tick interval in nanoseconds.
+    qint64 mInterval;
+
+    //! Used to store the next tick deadline in nanoseconds.
+    qint64 mDeadline = 0;
+
+    //! Used to store when the Pacer started in nanoseconds.
+    qint64 mStarted = 0;
+
+    //! Used to count the ticks emitted.
+    qint64 mTicks = 0;
+
+    //! Used to count the deadlines missed by more than an interval.
+    qint64 mMissed = 0;
+
+    //! Used to count the missed ticks dropped instead of caught up.
+    qint64 mDropped = 0;
+
+    //! Used to store the latest a deadline was reached, in nanoseconds.
+    qint64 mMaxLate = 0;
+}; // class Pacer
+
+#endif // PACER_H
@@ -13,6 +13,8 @@ This file contains the Physics class implementation for the application.
 // QtMath Required for round, floor, ceil...
 #include <QtMath>
 
+// settings.h header file required for the iteration budget.
+#include "settings.h"
 // trace.h header file required for tracing execution.
 #include "trace.h"
 
@@ -23,13 +25,15 @@ This file contains the Physics class implementation for the application.
 //! Create the Physics.
 //! Automatically called when the World is constructed.
 //! \param timeInterval is the time interval in milliseconds between Physics updates.
+//! \param bus is a reference to the Bus the Player topics are published on.
+//! \param latency is a reference to the Latency measurement.
 //! \param level is a refernece to the Level data.
 //! \param player is a reference to the Player data.
-Physics::Physics(int timeInterval, Level &level, Player &player) :
-    mTimeInterval( timeInterval * 0.001f ), mLevel( level ), mPlayer( player )
+Physics::Physics(int timeInterval, Bus &bus, Latency &latency, Level &level, Player &player) :
+    mTimeInterval( timeInterval * 0.001f ), mTickInterval( timeInterval * Q_INT64_C( 1000000 ) ), mBus( bus ), mLatency( latency ), mLevel( level ), mPlayer( player )
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "Physics::Physics(int timeInterval, Level &level, Player &player)...";
-} // Physics::Physics(int timeInterval, Level &level, Player &player)
+    TraceOut( TRACE_FILE_EXECUTION ) << "Physics::Physics(int timeInterval, Bus &bus, Latency &latency, Level &level, Player &player)...";
+} // Physics::Physics(int timeInterval, Bus &bus, Latency &latency, Level &level, Player &player)
 
 //! The Physics execution ends here.
 //! Required to free the Physics allocated memory.
@@ -1020,14 +1024,32 @@ void Physics::forces()
     //! Calculate the sum of accelerations
     QVector3D acceleration;
 
+    //! Turn the time the Player keys were held since the last tick into the user force.
+    mPlayer.sample( mNow, mTickInterval );
+
+    //! If the user has applied a force, time stamp it for the Latency measurement.
+    mForced = ( mPlayer.force().isNull() == false );
+    if( mForced == true )
+    {
+        mLatency.forceApplied();
+    } // if( mForced == true )
+
     //! Calculate how much force the user has applied to the mass.
     acceleration += mPlayer.force().normalized() * ( mPlayer.force().length() / mPlayer.mass() );
     //! Reset applied user force to zero until next tick.
     mPlayer.force() = QVector3D(0,0,0);
 
     //! If the Player is on a Cube.
-    if( mLevel.playerOnACube( mPlayer.position() ) == true )
+    bool onACube = mLevel.playerOnACube( mPlayer.position() );
+    if( onACube == true )
     {
+        //! *If the Player has just landed, publish the Cube type landed on.
+        if( mOnACube == false )
+        {
+            QVector3D position = mPlayer.position();
+            mBus.publishLandedOnType( mLevel.cubeTypeAt( qRound( position.x() ), qRound( position.y() ) - 1, qRound( position.z() ) ) );
+        } // if( mOnACube == false )
+
         //! *Apply rolling resistance to the Players movement.
         acceleration += mPlayer.velocity().normalized() * mPlayer.rollingResistanceCoefficient() * mPlayer.mass() * -GRAVITY;
     } // if( mLevel.playerOnACube( mPlayer.position() ) == true )
@@ -1037,6 +1059,7 @@ void Physics::forces()
         //! *Apply gravity.
         acceleration += QVector3D(0.0f,-GRAVITY,0.0f);
     } // if( mLevel.playerOnACube( mPlayer.position() ) == true ) else
+    mOnACube = onACube;
 
     //! Apply the sum of accelerations to the velocity for the time step.
     mPlayer.velocity() += acceleration * mTimeInterval;
@@ -1079,6 +1102,17 @@ void Physics::movement()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Physics::movement()...";
 
+    mIterations = 0;
+    mCollisions = 0;
+    mTicks++;
+
+    //! If the Player is at rest, there is nothing to move or to test.
+    if( mPlayer.velocity().isNull() == true )
+    {
+        mRestTicks++;
+        return;
+    } // if( mPlayer.velocity().isNull() == true )
+
     //! Create a internal position to track were to move the player over the time interval.
     QVector3D intervalPosition = mPlayer.position();
     //! Create a internal distance to track how far to move the player over the time interval.
@@ -1087,16 +1121,73 @@ void Physics::movement()
     //! Move the player over the distance.
     while( intervalDistance.length() > 0 )
     {
+        //! *If the iteration budget is spent, drop the rest of the distance.
+        if( mIterations == PHYSICS_ITERATION_BUDGET )
+        {
+            mExhaustedTicks++;
+            break;
+        } // if( mIterations == PHYSICS_ITERATION_BUDGET )
+        mIterations++;
+
         //! *Check for collisions with the Level over the distance to travel for the time interval.
         collisionDetection(intervalPosition, intervalDistance);
+        bool collided = ( mCollisionData.distance != FLT_MAX );
         //! *Move the Player to first point of collision or to end of distance to travel for time interval.
         collisionResponse(intervalPosition, intervalDistance);
+
+        //! *If the Player collided.
+        if( collided == true )
+        {
+            mCollisions++;
+
+            //! **If it landed on a face with less distance left than the position precision, it is at rest.
+            if( mCollisionData.normal.y() == 1.0f && intervalDistance.length() < PHYSICS_REST_DISTANCE )
+            {
+                break;
+            } // if( mCollisionData.normal.y() == 1.0f && ... )
+        } // if( collided == true )
     } //! Repeat until entire distance has been traveled.
 
     //! Update the Players position based on the end result of the internal tracking position.
     mPlayer.position() = intervalPosition;
+
+    //! Count the iterations and collisions for the report.
+    mTotalIterations += mIterations;
+    mTotalCollisions += mCollisions;
+    mMaxIterations = qMax( mMaxIterations, mIterations );
 } // Physics::movement()
 
+//! Publish the Player topics that changed since the last tick.
+//! Only changes are published so the Game State Machine tests nothing while the Player rolls within a cell.
+//! \return void
+//! \sa Bus, Game
+void Physics::publish()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Physics::publish()...";
+
+    QVector3D position = mPlayer.position();
+
+    //! If the Player has left the Level bounds since the last tick.
+    bool insideLevel = mLevel.insideLevel( position );
+    if( insideLevel == false && mInsideLevel == true )
+    {
+        //! *Publish it.
+        mBus.publish( Bus::TOPIC_LEFT_LEVEL );
+    } // if( insideLevel == false && mInsideLevel == true )
+    mInsideLevel = insideLevel;
+
+    //! If the Player has entered a new cell.
+    int column = qRound( position.x() );
+    int row = qRound( position.z() );
+    if( column != mCellColumn || row != mCellRow )
+    {
+        //! *Publish it with the type of the Cube under the Player, a Span above the cell included.
+        mCellColumn = column;
+        mCellRow = row;
+        mBus.publishEnteredCell( column, row, mLevel.cubeTypeAt( column, qRound( position.y() ) - 1, row ) );
+    } // if( column != mCellColumn || row != mCellRow )
+} // Physics::publish()
+
 //! Calculate the reflection of a given vector around a given normal.
 //! \param input is the vector to reflect.
 //! \param normal is to reflect around.
@@ -1148,6 +1239,45 @@ QVector3D Physics::removeFuzz( const QVector3D& input )
     return output;
 } // Physics::removeFuzz( const QVector3D& input )
 
+//! Report the collision iteration, collision and sleep counts.
+//! \param out is the stream to report to.
+//! \return void
+void Physics::report( QTextStream & out )
+{
+    out << "physics: " << mTicks << " ticks, " << mRestTicks << " at rest, "
+        << mTotalIterations << " iterations, " << mTotalCollisions << " collisions, max "
+        << mMaxIterations << " iterations in a tick, budget of " << PHYSICS_ITERATION_BUDGET
+        << " spent " << mExhaustedTicks << " times" << endl;
+    out << "physics: " << mSleeps << " sleeps, " << mSleptTicks << " ticks skipped asleep" << endl;
+} // Physics::report( QTextStream & out )
+
+//! Count the ticks the Player is at rest, and put it to sleep once it has rested long enough.
+//! The Player is at rest when it is on a Cube, every velocity component is below the
+//! MINIMUM_VELOCITY and so was zeroed, and no user force was applied.
+//! \return void
+void Physics::rest()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Physics::rest()...";
+
+    //! If the Player is not at rest, start counting again.
+    if( mOnACube == false || mPlayer.velocity().isNull() == false || mForced == true )
+    {
+        mQuietTicks = 0;
+        return;
+    } // if( mOnACube == false || ... )
+
+    //! If the Player has rested long enough, put it to sleep.
+    mQuietTicks++;
+    if( mQuietTicks >= PHYSICS_SLEEP_TICKS )
+    {
+        //! *Remember the state that must not change while it sleeps.
+        mSleeping = true;
+        mSleepPosition = mPlayer.position();
+        mSleepGeneration = mLevel.generation();
+        mSleeps++;
+    } // if( mQuietTicks >= PHYSICS_SLEEP_TICKS )
+} // Physics::rest()
+
 //! Roll the player.
 //! \param distance is the how far the player will roll.
 //! \return void
@@ -1167,19 +1297,79 @@ void Physics::roll( QVector3D & distance )
     mPlayer.rotation() = QQuaternion::fromAxisAndAngle( axis, angle ) * mPlayer.rotation();
 } // Physics::roll( QVector3D & distance )
 
+//! Find out if the sleeping Player should stay asleep.
+//! The Player Input is sampled, so a user force wakes the Player and is applied on this
+//! tick. A change of the Player position or velocity, a Level reload or reset, or a change
+//! of the Level data also wakes it.
+//! \return bool is true when the Player stays asleep.
+bool Physics::stillAsleep()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Physics::stillAsleep()...";
+
+    //! Turn the time the Player keys were held since the last tick into the user force.
+    mPlayer.sample( mNow, mTickInterval );
+
+    //! If anything the rest depended on changed, wake up.
+    if( mPlayer.force().isNull() == false ||
+        mPlayer.velocity().isNull() == false ||
+        mPlayer.position() != mSleepPosition ||
+        mLevel.generation() != mSleepGeneration )
+    {
+        wake();
+        return false;
+    } // if( mPlayer.force().isNull() == false || ... )
+
+    return true;
+} // Physics::stillAsleep()
+
 //! Update the Physics.
+//! \param now is the Input time stamp to sample the Player keys up to, in nanoseconds.
 //! \return void
-//! \sa Physics, Player, Level
-void Physics::tick()
+//! \sa Physics, Player, Level, Input
+void Physics::tick( qint64 now )
 {
-    TraceOut( TRACE_FILE_EXECUTION ) << "Physics::tick()...";
+    TraceOut( TRACE_FILE_EXECUTION ) << "Physics::tick( qint64 now )...";
+
+    mNow = now;
+
+    //! If the Player is asleep and nothing woke it, there is nothing to update.
+    if( mSleeping == true && stillAsleep() == true )
+    {
+        mSleptTicks++;
+        return;
+    } // if( mSleeping == true && stillAsleep() == true )
 
     mHalfCubeSize = mLevel.cubeSize() / 2.0f;
     mSphereRadius = mPlayer.sphereRadius();
 
+    //! Remember the Player position to detect movement for the Latency measurement.
+    QVector3D position = mPlayer.position();
+
     //! Calculate forces.
     forces();
 
     //! Apply forces..
     movement();
-} // Physics::tick()
+
+    //! If the Player moved, time stamp it for the Latency measurement.
+    if( mPlayer.position() != position )
+    {
+        mLatency.positionChanged();
+    } // if( mPlayer.position() != position )
+
+    //! Publish the Player topics that changed.
+    publish();
+
+    //! Put the Player to sleep once it has rested long enough.
+    rest();
+} // Physics::tick( qint64 now )
+
+//! Wake the Player, the next tick updates it and it must rest again before it sleeps.
+//! \return void
+void Physics::wake()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Physics::wake()...";
+
+    mSleeping = false;
+    mQuietTicks = 0;
+} // Physics::wake()
@@ -6,14 +6,29 @@ This file contains the Physics class declaration for the application.
 #ifndef PHYSICS_H
 #define PHYSICS_H
 
+// bus.h header file required for publishing Player topics.
+#include "bus.h"
+// latency.h header file required for latency measurement.
+#include "latency.h"
 // level.h header file required for level data access.
 #include "level.h"
 // player.h header file required for player data access.
 #include "player.h"
 
+// QTextStream header file required for reporting.
+#include <QTextStream>
+
 //! Physics class.
 /*!
 This class declaration encapsulates the Physics functionality.
+Every tick the Player moves by its velocity over the time interval, colliding with the
+Level along the way. Each collision takes one iteration of detection and response, so the
+iterations spent in a tick are capped by a budget and stop early once the Player comes to
+rest on a face. A Player at rest costs no collision tests at all and one rolling freely
+costs a single iteration. The iterations and collisions are counted for the report.
+A Player that stays at rest on a Cube with no user force for a few ticks is put to sleep,
+and its ticks are skipped until a user force, a change of the Player state or a change of
+the Level data wakes it.
 */
 class Physics
 {
@@ -21,12 +36,30 @@ class Physics
     friend class World;
 
 public: // Member Functions
-    //! Called to update the Physics.
-    void tick();
+    //! Called to find out if a user force was applied on the last tick.
+    bool forced() const { return mForced; }
+
+    //! Called to get the number of collisions on the last tick.
+    uint collisions() const { return mCollisions; }
+
+    //! Called to get the number of collision iterations spent on the last tick.
+    uint iterations() const { return mIterations; }
+
+    //! Called to report the iteration, collision and sleep counts.
+    void report( QTextStream & out );
+
+    //! Called to find out if the Player is asleep and its ticks are skipped.
+    bool sleeping() const { return mSleeping; }
+
+    //! Called to update the Physics with the Player input sampled up to now.
+    void tick( qint64 now );
+
+    //! Called to wake the Player, so the next tick runs.
+    void wake();
 
 private: // Constructors / Destructors
     //! Physics class constructor.
-    Physics( int timeInterval, Level & level, Player & player );
+    Physics( int timeInterval, Bus & bus, Latency & latency, Level & level, Player & player );
 
     //! Physics class destructor.
     ~Physics();
@@ -56,12 +89,81 @@ private: // Member Variables
     //! Used to store the time delta to apply the physics over in seconds.
     float mTimeInterval;
 
+    //! Used to store the time delta to sample the Player input over in nanoseconds.
+    qint64 mTickInterval;
+
+    //! Used to store the time stamp to sample the Player input up to this tick.
+    qint64 mNow = 0;
+
+    //! Used to remember if a user force was applied on the last tick, initialized to false.
+    bool mForced = false;
+
+    //! Used to hold a reference to the Bus the Player topics are published on;
+    Bus & mBus;
+
+    //! Used to hold a reference to the Latency measurement;
+    Latency & mLatency;
+
     //! Used to hold a reference to the Level data;
     Level  & mLevel;
 
     //! Used to hold a reference to the Player data;
     Player & mPlayer;
 
+    //! Used to remember the column of the cell the Player was last in, initialized to none.
+    int mCellColumn = -1;
+
+    //! Used to remember the row of the cell the Player was last in, initialized to none.
+    int mCellRow = -1;
+
+    //! Used to remember if the Player was inside the Level last tick, initialized to false.
+    bool mInsideLevel = false;
+
+    //! Used to remember if the Player was on a Cube last tick, initialized to false.
+    bool mOnACube = false;
+
+    //! Used to count the collision iterations spent on the last tick.
+    uint mIterations = 0;
+
+    //! Used to count the collisions on the last tick.
+    uint mCollisions = 0;
+
+    //! Used to count the ticks moved.
+    qint64 mTicks = 0;
+
+    //! Used to count the ticks the Player was at rest and nothing was tested.
+    qint64 mRestTicks = 0;
+
+    //! Used to count the ticks the iteration budget ran out.
+    qint64 mExhaustedTicks = 0;
+
+    //! Used to count the collision iterations spent over every tick.
+    qint64 mTotalIterations = 0;
+
+    //! Used to count the collisions over every tick.
+    qint64 mTotalCollisions = 0;
+
+    //! Used to store the most collision iterations spent on a tick.
+    uint mMaxIterations = 0;
+
+    //! Used to count the consecutive ticks the Player was at rest on a Cube.
+    uint mQuietTicks = 0;
+
+    //! Used to remember if the Player is asleep, initialized to false.
+    bool mSleeping = false;
+
+    //! Used to store the Player position when it went to sleep.
+    QVector3D mSleepPosition;
+
+    //! Used to store the Level generation when the Player went to sleep.
+    uint mSleepGeneration = 0;
+
+    //! Used to count the times the Player went to sleep.
+    qint64 mSleeps = 0;
+
+    //! Used to count the ticks skipped while the Player was asleep.
+    qint64 mSleptTicks = 0;
+
 private: // Data Constants
     //! Standard gravity constant.
     const float GRAVITY = 9.81f;
@@ -97,6 +199,12 @@ private: // Helper Functions
     //! Called to apply all the forces.
     void movement();
 
+    //! Called to publish the Player topics that changed this tick.
+    void publish();
+
+    //! Called after a tick to count the ticks at rest and put the Player to sleep.
+    void rest();
+
     //! Called to get a reflection of a given vector around a given normal.
     QVector3D reflectionVector( QVector3D & input, QVector3D & normal );
 
@@ -108,6 +216,9 @@ private: // Helper Functions
 
     //! Called to roll the player by the given distance.
     void roll( QVector3D & distance );
+
+    //! Called while the Player is asleep to find out if it should stay asleep.
+    bool stillAsleep();
 };
 
 #endif // PHYSICS_H
@@ -6,9 +6,6 @@ This file contains the Player class implementation for the application.
 // player.h header file required for class definition.
 #include "player.h"
 
-// QKeyEvent header file required for KeyPress Event.
-#include <QKeyEvent>
-
 // trace.h header file required for tracing execution.
 #include "trace.h"
 
@@ -41,55 +38,8 @@ bool Player::event( QEvent * event )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Player::event( QEvent * event ): " << event->type() << "...";
 
-    //! Return value, assume processed until otherwise determined.
-    bool rVal = true;
-
-    //! Determine what type of event was received.
-    switch( event->type() )
-    {
-    //! When it is a KeyPress event type.
-    case QEvent::KeyPress:
-        //! Determine which key was pressed.
-        switch( ((QKeyEvent*)event)->key() )
-        {
-        //! When it is the Down key.
-        case Qt::Key_Down:
-            //! Apply the force in the negative direction.
-            mForce += -mDirection * mUserStrength;
-            break;
-
-        //! When it is the Left key.
-        case Qt::Key_Left:
-            //! Apply the force to the left of the direction.
-            mForce += QVector3D( mDirection.z(), 0, (-1 * mDirection.x()) ) * mUserStrength;
-            break;
-
-        //! When it is the Right key.
-        case Qt::Key_Right:
-            //! Apply the force to the Right of the direction.
-            mForce += QVector3D( (-1 * mDirection.z()), 0, mDirection.x() ) * mUserStrength;
-            break;
-
-        //! When it is the Up key.
-        case Qt::Key_Up:
-            //! Apply the force in the direction.
-            mForce += mDirection * mUserStrength;
-            break;
-
-        //! When it is any other key.
-        default:
-            //! Dont process the key press event and set the return value to false.
-            rVal = false;
-            break;
-        }
-        break;
-
-    //! When it is any other event.
-    default:
-        //! Dont process the event and set the return value to false.
-        rVal = false;
-        break;
-    }
+    //! Record the key presses and releases, the force is applied when the Input is sampled.
+    bool rVal = mInput.event( event );
 
     //! Return status of event processing.
     return rVal;
@@ -101,14 +51,8 @@ void Player::load()
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Player::load()...";
 
-    //! Reset the player heading direction.
-    mDirection = QVector3D(0,0,1);
-
-    //! Reset the user force.
-    mForce = QVector3D( 0.0f, 0.0f, 0.0f );
-
-    //! reset the user velocity.
-    mVelocity = QVector3D( 0.0f, 0.0f, 0.0f );
+    //! Reset the Player motion.
+    reset();
 
     //! Load the Sphere openGL resources.
     mSphere.load();
@@ -126,6 +70,70 @@ void Player::render( const Camera & camera, const Light & light )
     mSphere.render( camera, light );
 } // Player::render( const Camera & camera, const Light & light )
 
+//! Reset the Player heading, force, and velocity.
+//! \return void
+void Player::reset()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Player::reset()...";
+
+    //! Reset the player heading direction.
+    mDirection = QVector3D(0,0,1);
+
+    //! Reset the user force.
+    mForce = QVector3D( 0.0f, 0.0f, 0.0f );
+
+    //! reset the user velocity.
+    mVelocity = QVector3D( 0.0f, 0.0f, 0.0f );
+
+    //! Release the keys, they must be pressed again.
+    mInput.reset();
+} // Player::reset()
+
+//! Turn the time the keys were held since the last sample into the user force.
+//! A key held for the whole interval applies the full user strength, a key tapped
+//! within the interval applies the fraction of it the key was held. A sample covering
+//! more than an interval, after a stall, still applies no more than the full strength.
+//! \param now is the time stamp to sample the Input up to, in nanoseconds.
+//! \param interval is the tick time interval, in nanoseconds.
+//! \return void
+void Player::sample( qint64 now, qint64 interval )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Player::sample( qint64 now, qint64 interval )...";
+
+    //! Integrate the time each key was held.
+    qint64 held[ Input::KEY_COUNT ];
+    mInput.sample( now, interval, held );
+
+    for( int key = 0; key < Input::KEY_COUNT; key++ )
+    {
+        held[ key ] = qMin( held[ key ], interval );
+    } // for( int key = 0; key < Input::KEY_COUNT; key++ )
+
+    //! If the Up key was held, apply the force in the direction.
+    if( held[ Input::KEY_UP ] > 0 )
+    {
+        mForce += mDirection * ( mUserStrength * ( (float)held[ Input::KEY_UP ] / interval ) );
+    }
+
+    //! If the Down key was held, apply the force in the negative direction.
+    if( held[ Input::KEY_DOWN ] > 0 )
+    {
+        mForce += -mDirection * ( mUserStrength * ( (float)held[ Input::KEY_DOWN ] / interval ) );
+    }
+
+    //! If the Left key was held, apply the force to the left of the direction.
+    if( held[ Input::KEY_LEFT ] > 0 )
+    {
+        mForce += QVector3D( mDirection.z(), 0, (-1 * mDirection.x()) ) * ( mUserStrength * ( (float)held[ Input::KEY_LEFT ] / interval ) );
+    }
+
+    //! If the Right key was held, apply the force to the Right of the direction.
+    if( held[ Input::KEY_RIGHT ] > 0 )
+    {
+        mForce += QVector3D( (-1 * mDirection.z()), 0, mDirection.x() ) * ( mUserStrength * ( (float)held[ Input::KEY_RIGHT ] / interval ) );
+    }
+} // Player::sample( qint64 now, qint64 interval )
+
 //! Update the Player.
 //! \return void
 void Player::tick()
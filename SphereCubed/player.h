@@ -11,6 +11,8 @@ This file contains the Player class declaration for the application.
 
 // camera.h header file required for rendering.
 #include "camera.h"
+// input.h header file required for the key Input.
+#include "input.h"
 // light.h header file required for rendering.
 #include "light.h"
 // sphere.h header file required for class definition.
@@ -35,6 +37,9 @@ public: // Access Functions
     //! Called to get/set the applied force to the Player.
     QVector3D & force() { return mForce; }
 
+    //! Called to get the key Input of the Player.
+    Input & input() { return mInput; }
+
     //! Called to get/set the number of layer lives.
     uint & lives() { return mLives; }
 
@@ -66,6 +71,12 @@ public: // Member Functions
     //! Called to render the Player OpenGL resources.
     void render( const Camera & camera, const Light & light );
 
+    //! Called to reset the Player motion without touching OpenGL resources.
+    void reset();
+
+    //! Called once per tick to turn the time the keys were held into the user force.
+    void sample( qint64 now, qint64 interval );
+
     //! Called to update the Player.
     void tick();
 
@@ -90,6 +101,9 @@ private:
     //! Used to store the force the user is applying to the player.
     QVector3D mForce;
 
+    //! Used to record the key Input.
+    Input mInput;
+
     //! Used to track the number of lives the Player has remaining.
     uint mLives = 0;
 
@@ -0,0 +1,451 @@
+/*! \file regression.cpp
+\brief Regression class implementation file.
+This file contains the Regression class implementation for the application.
+*/
+
+// regression.h header file required for Regression class definition.
+#include "regression.h"
+
+// QDir header file required for golden directory handling.
+#include <QDir>
+// QElapsedTimer header file required for timing the runs.
+#include <QElapsedTimer>
+// QFile header file required for golden file access.
+#include <QFile>
+// QStringList header file required for golden file parsing.
+#include <QStringList>
+
+// cstring header file required for float bit access.
+#include <cstring>
+// limits header file required for integer limits.
+#include <limits>
+
+// jobs.h header file required for running the Levels in parallel.
+#include "jobs.h"
+// levelpack.h header file required for the number of Levels.
+#include "levelpack.h"
+// settings.h header file required for golden settings.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! Number of values stored per golden sample.
+#define REGRESSION_VALUE_COUNT 10
+
+//! Names of the values stored per golden sample, used when reporting a divergence.
+static const char * const REGRESSION_VALUE_NAMES[ REGRESSION_VALUE_COUNT ] =
+{
+    "position.x", "position.y", "position.z",
+    "velocity.x", "velocity.y", "velocity.z",
+    "rotation.x", "rotation.y", "rotation.z", "rotation.scalar"
+};
+
+//! The Regression execution begins here.
+//! Create a Regression, every Level runs in its own World.
+//! \param timeInterval is the time interval in mS between physics updates.
+Regression::Regression( int timeInterval ) :
+    mTimeInterval( timeInterval ),
+    mTickInterval( timeInterval * Q_INT64_C( 1000000 ) ),
+    mOut( stdout )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Regression::Regression()...";
+} // Regression::Regression()
+
+//! The Regression execution ends here.
+//! Destroy the Regression.
+Regression::~Regression()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Regression::~Regression()...";
+} // Regression::~Regression()
+
+//! Record the golden trajectory of every Level into a directory.
+//! \param directory is the directory to write the golden files to.
+//! \return int is the process exit status, zero on success.
+int Regression::record( const QString & directory )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Regression::record()...";
+
+    //! Make sure the golden directory exists.
+    if( !QDir().mkpath( directory ) )
+    {
+        mOut << "Unable to create golden directory " << directory << endl;
+        return 1;
+    }
+
+    //! Run every Level.
+    QVector< QVector<Sample> > samples;
+    QVector<bool> loaded;
+    runAll( samples, loaded );
+
+    //! Write the trajectory of every Level.
+    for( uint levelIndex = 1; levelIndex <= (uint)samples.size(); levelIndex++ )
+    {
+        if( !loaded[ levelIndex - 1 ] || !writeGolden( goldenPath( directory, levelIndex ), samples[ levelIndex - 1 ] ) )
+        {
+            mOut << "Level " << levelIndex << ": unable to record golden trajectory" << endl;
+            return 1;
+        }
+
+        mOut << "Level " << levelIndex << ": recorded " << samples[ levelIndex - 1 ].size() << " ticks" << endl;
+    }
+
+    return 0;
+} // Regression::record()
+
+//! Verify the Physics of every Level against the golden trajectories in a directory.
+//! Reports the first diverging tick and value of each Level.
+//! \param directory is the directory to read the golden files from.
+//! \param ulpTolerance is the maximum allowed distance in units in the last place.
+//! \return int is the process exit status, zero when every Level matches.
+int Regression::verify( const QString & directory, qint64 ulpTolerance )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Regression::verify()...";
+
+    //! Number of Levels that did not match their golden trajectory.
+    int failures = 0;
+
+    //! Time all of the runs together.
+    QElapsedTimer timer;
+    timer.start();
+
+    //! Run every Level.
+    QVector< QVector<Sample> > runs;
+    QVector<bool> loaded;
+    runAll( runs, loaded );
+
+    for( uint levelIndex = 1; levelIndex <= (uint)runs.size(); levelIndex++ )
+    {
+        QVector<Sample> golden;
+        const QVector<Sample> & samples = runs[ levelIndex - 1 ];
+
+        if( !readGolden( goldenPath( directory, levelIndex ), golden ) )
+        {
+            mOut << "Level " << levelIndex << ": missing or malformed golden file" << endl;
+            failures++;
+            continue;
+        }
+
+        if( !loaded[ levelIndex - 1 ] )
+        {
+            mOut << "Level " << levelIndex << ": unable to load level" << endl;
+            failures++;
+            continue;
+        }
+
+        if( golden.size() != samples.size() )
+        {
+            mOut << "Level " << levelIndex << ": golden has " << golden.size() << " ticks, run has " << samples.size() << endl;
+            failures++;
+            continue;
+        }
+
+        //! Find the first tick and value exceeding the tolerance.
+        bool diverged = false;
+
+        for( int tick = 0; tick < samples.size() && !diverged; tick++ )
+        {
+            for( int index = 0; index < REGRESSION_VALUE_COUNT && !diverged; index++ )
+            {
+                qint64 distance = ulpDistance( golden[tick].value[index], samples[tick].value[index] );
+
+                if( distance > ulpTolerance )
+                {
+                    mOut << "Level " << levelIndex << ": diverged at tick " << tick
+                         << " " << REGRESSION_VALUE_NAMES[index]
+                         << " golden " << QString::number( golden[tick].value[index], 'g', 9 )
+                         << " actual " << QString::number( samples[tick].value[index], 'g', 9 )
+                         << " (" << distance << " ulp)" << endl;
+                    diverged = true;
+                }
+            }
+        }
+
+        if( diverged )
+        {
+            failures++;
+        }
+        else
+        {
+            mOut << "Level " << levelIndex << ": ok" << endl;
+        }
+    }
+
+    mOut << failures << " of " << runs.size() << " levels diverged in " << timer.elapsed() << " mS" << endl;
+
+    return ( failures == 0 ) ? 0 : 1;
+} // Regression::verify()
+
+//! Get the golden file path for a Level.
+//! \param directory is the golden directory.
+//! \param levelIndex is the Level index.
+//! \return QString is the golden file path.
+QString Regression::goldenPath( const QString & directory, uint levelIndex )
+{
+    return QDir( directory ).filePath( "Level" + QString::number( levelIndex ) + ".golden" );
+} // Regression::goldenPath()
+
+//! Read a golden trajectory file.
+//! Each line holds the tick, the held keys and the ten state values.
+//! \param path is the golden file path.
+//! \param samples is filled with the golden samples.
+//! \return bool is true when the file was read.
+bool Regression::readGolden( const QString & path, QVector<Sample> & samples )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Regression::readGolden()...";
+
+    QFile file( path );
+
+    if( !file.open( QIODevice::ReadOnly | QIODevice::Text ) )
+    {
+        return false;
+    }
+
+    QTextStream in( &file );
+
+    while( !in.atEnd() )
+    {
+        QString line = in.readLine().trimmed();
+
+        //! Skip empty lines.
+        if( line.isEmpty() )
+        {
+            continue;
+        }
+
+        QStringList fields = line.split( ' ', QString::SkipEmptyParts );
+
+        if( fields.size() != REGRESSION_VALUE_COUNT + 2 || fields[0].toInt() != samples.size() )
+        {
+            return false;
+        }
+
+        Sample sample;
+        bool ok = true;
+
+        sample.keys = fields[1].toUInt( &ok );
+
+        for( int index = 0; index < REGRESSION_VALUE_COUNT && ok; index++ )
+        {
+            sample.value[index] = fields[index + 2].toFloat( &ok );
+        }
+
+        if( !ok )
+        {
+            return false;
+        }
+
+        samples.append( sample );
+    }
+
+    return !samples.isEmpty();
+} // Regression::readGolden()
+
+//! Run the scripted input sequence on a Level.
+//! Only the Level data is loaded, no OpenGL resources are required.
+//! \param levelIndex is the Level index.
+//! \param world is the World to run the Level in.
+//! \param samples is filled with the Player state after every tick.
+//! \return bool is true when the Level was run.
+bool Regression::run( World & world, uint levelIndex, QVector<Sample> & samples )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Regression::run()...";
+
+    Level & level = world.level();
+    Player & player = world.player();
+
+    //! Load the Level data.
+    level.levelIndex() = levelIndex;
+
+    if( !level.loadData() )
+    {
+        return false;
+    }
+
+    //! Place the Player at rest at the start position.
+    player.reset();
+    player.position() = level.startPosition();
+    player.rotation() = QQuaternion();
+
+    samples.reserve( GOLDEN_TICK_COUNT );
+
+    //! The scripted keys and the Player keys they press.
+    const uint scriptKeys[ Input::KEY_COUNT ] = { KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT };
+    const Input::Key playerKeys[ Input::KEY_COUNT ] = { Input::KEY_UP, Input::KEY_DOWN, Input::KEY_LEFT, Input::KEY_RIGHT };
+    uint heldKeys = 0;
+
+    for( uint tick = 0; tick < GOLDEN_TICK_COUNT; tick++ )
+    {
+        uint keys = script( levelIndex, tick );
+        qint64 tickStart = tick * mTickInterval;
+
+        //! Press and release the scripted keys at the start of the tick, on a synthetic clock.
+        for( int key = 0; key < Input::KEY_COUNT; key++ )
+        {
+            if( ( keys ^ heldKeys ) & scriptKeys[ key ] )
+            {
+                player.input().transition( playerKeys[ key ], ( keys & scriptKeys[ key ] ) != 0, tickStart );
+            }
+        } // for( int key = 0; key < Input::KEY_COUNT; key++ )
+        heldKeys = keys;
+
+        //! Update the physics, a key held for the whole tick applies the full user strength.
+        world.physics().tick( tickStart + mTickInterval );
+
+        //! Record the Player state.
+        Sample sample;
+        sample.keys = keys;
+        sample.value[0] = player.position().x();
+        sample.value[1] = player.position().y();
+        sample.value[2] = player.position().z();
+        sample.value[3] = player.velocity().x();
+        sample.value[4] = player.velocity().y();
+        sample.value[5] = player.velocity().z();
+        sample.value[6] = player.rotation().x();
+        sample.value[7] = player.rotation().y();
+        sample.value[8] = player.rotation().z();
+        sample.value[9] = player.rotation().scalar();
+        samples.append( sample );
+    }
+
+    return true;
+} // Regression::run()
+
+//! Run the scripted input sequence on every Level, a batch of Physics runs spread over the Jobs workers.
+//! Every Level runs in its own World, so the trajectories are the same as when run one after the other.
+//! \param samples is filled with the Player state after every tick, per Level.
+//! \param loaded is filled per Level, true when the Level was run.
+//! \return void
+void Regression::runAll( QVector< QVector<Sample> > & samples, QVector<bool> & loaded )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Regression::runAll()...";
+
+    uint levelCount = LevelPack::instance().count();
+
+    //! Size the results on this thread, the Jobs only write their own elements.
+    samples.fill( QVector<Sample>(), levelCount );
+    loaded.fill( false, levelCount );
+    QVector<Sample> * pSamples = samples.data();
+    bool * pLoaded = loaded.data();
+
+    //! Create the Worlds on this thread.
+    QVector< World * > worlds;
+    for( uint index = 0; index < levelCount; index++ )
+    {
+        worlds.append( new World( mTimeInterval ) );
+    }
+
+    //! Run one Level per Job.
+    Jobs::instance().parallelFor( 0, levelCount, 1, [ this, &worlds, pSamples, pLoaded ]( uint index )
+    {
+        pLoaded[ index ] = run( *worlds[ index ], index + 1, pSamples[ index ] );
+    } );
+
+    //! Free the Worlds.
+    foreach( World * pWorld, worlds )
+    {
+        delete pWorld;
+    }
+} // Regression::runAll()
+
+//! Get the scripted keys for a Level tick.
+//! The script is a deterministic sequence of held key segments seeded by the Level index,
+//! so the same Level always gets the same input independent of platform.
+//! \param levelIndex is the Level index.
+//! \param tick is the tick number.
+//! \return uint is the mask of held keys.
+uint Regression::script( uint levelIndex, uint tick )
+{
+    //! Key combinations the script picks from.
+    static const uint COMBINATIONS[] =
+    {
+        KEY_UP, KEY_UP, KEY_UP | KEY_RIGHT, KEY_RIGHT, 0,
+        KEY_UP | KEY_LEFT, KEY_LEFT, KEY_DOWN, 0, KEY_UP
+    };
+
+    //! Linear congruential generator seeded by the Level index.
+    quint32 state = 0x9E3779B9u * levelIndex;
+    uint start = 0;
+
+    forever
+    {
+        state = state * 1664525u + 1013904223u;
+        uint keys = COMBINATIONS[ ( state >> 16 ) % ( sizeof( COMBINATIONS ) / sizeof( COMBINATIONS[0] ) ) ];
+
+        state = state * 1664525u + 1013904223u;
+        uint length = 5 + ( ( state >> 16 ) % 40 );
+
+        if( tick < start + length )
+        {
+            return keys;
+        }
+
+        start += length;
+    }
+} // Regression::script()
+
+//! Get the distance between two floats in units in the last place.
+//! The float bits are mapped onto a monotonic integer line so adjacent floats differ by one.
+//! \param a is the first float.
+//! \param b is the second float.
+//! \return qint64 is the distance.
+qint64 Regression::ulpDistance( float a, float b )
+{
+    //! Identical values, including both zeros, are no distance apart.
+    if( a == b )
+    {
+        return 0;
+    }
+
+    //! Any NaN is infinitely far from everything.
+    if( a != a || b != b )
+    {
+        return std::numeric_limits<qint64>::max();
+    }
+
+    qint32 ia;
+    qint32 ib;
+    std::memcpy( &ia, &a, sizeof( ia ) );
+    std::memcpy( &ib, &b, sizeof( ib ) );
+
+    //! Map negative floats below the positive ones.
+    qint64 la = ( ia < 0 ) ? ( qint64( std::numeric_limits<qint32>::min() ) - ia ) : ia;
+    qint64 lb = ( ib < 0 ) ? ( qint64( std::numeric_limits<qint32>::min() ) - ib ) : ib;
+
+    return ( la > lb ) ? ( la - lb ) : ( lb - la );
+} // Regression::ulpDistance()
+
+//! Write a golden trajectory file.
+//! \param path is the golden file path.
+//! \param samples are the samples to write.
+//! \return bool is true when the file was written.
+bool Regression::writeGolden( const QString & path, const QVector<Sample> & samples )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Regression::writeGolden()...";
+
+    QFile file( path );
+
+    if( !file.open( QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text ) )
+    {
+        return false;
+    }
+
+    QTextStream out( &file );
+
+    for( int tick = 0; tick < samples.size(); tick++ )
+    {
+        out << tick << " " << samples[tick].keys;
+
+        //! Nine significant digits round trip a float exactly.
+        for( int index = 0; index < REGRESSION_VALUE_COUNT; index++ )
+        {
+            out << " " << QString::number( samples[tick].value[index], 'g', 9 );
+        }
+
+        out << "\n";
+    }
+
+    return true;
+} // Regression::writeGolden()
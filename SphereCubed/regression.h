@@ -0,0 +1,94 @@
+/*! \file regression.h
+\brief Regression class declaration file.
+This file contains the Regression class declaration for the application.
+*/
+
+#ifndef REGRESSION_H
+#define REGRESSION_H
+
+// QString header file required for file paths.
+#include <QString>
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for trajectory storage.
+#include <QVector>
+
+// world.h header file required for World access.
+#include "world.h"
+
+//! Regression class.
+/*!
+This class declaration encapsulates the golden trajectory Regression functionality.
+A scripted input sequence is replayed on every Level through Physics::tick() without
+any OpenGL resources, each Level in its own World on the Jobs workers, and the per-tick
+Player state is recorded to or compared against golden files.
+*/
+class Regression
+{
+public: // Constructors / Destructors
+    //! Regression class constructor.
+    explicit Regression( int timeInterval );
+
+    //! Regression class destructor.
+    ~Regression();
+
+public: // Member Functions
+    //! Called to record the golden trajectory files into a directory.
+    int record( const QString & directory );
+
+    //! Called to verify the Physics against the golden trajectory files in a directory.
+    int verify( const QString & directory, qint64 ulpTolerance );
+
+private: // Data Types
+    //! Internal scripted key bit masks.
+    enum Keys
+    {
+        KEY_UP    = 0x01, //!< - Up key held.
+        KEY_DOWN  = 0x02, //!< - Down key held.
+        KEY_LEFT  = 0x04, //!< - Left key held.
+        KEY_RIGHT = 0x08  //!< - Right key held.
+    }; // enum Keys
+
+    //! Internal per-tick trajectory sample.
+    struct Sample
+    {
+        //! - Scripted keys held during the tick.
+        uint keys;
+        //! - Player state after the tick, position, velocity and rotation.
+        float value[10];
+    }; // struct Sample
+
+private: // Member Variables
+    //! Used to store the tick time interval in milliseconds, for the Worlds the Physics runs in.
+    int mTimeInterval;
+
+    //! Used to store the tick time interval in nanoseconds.
+    qint64 mTickInterval;
+
+    //! Used to write the report.
+    QTextStream mOut;
+
+private: // Helper Functions
+    //! Called to get the golden file path for a Level.
+    QString goldenPath( const QString & directory, uint levelIndex );
+
+    //! Called to read a golden trajectory file.
+    bool readGolden( const QString & path, QVector<Sample> & samples );
+
+    //! Called to run the scripted input sequence on a Level.
+    bool run( World & world, uint levelIndex, QVector<Sample> & samples );
+
+    //! Called to run the scripted input sequence on every Level in parallel.
+    void runAll( QVector< QVector<Sample> > & samples, QVector<bool> & loaded );
+
+    //! Called to get the scripted keys for a Level tick.
+    uint script( uint levelIndex, uint tick );
+
+    //! Called to get the distance between two floats in units in the last place.
+    qint64 ulpDistance( float a, float b );
+
+    //! Called to write a golden trajectory file.
+    bool writeGolden( const QString & path, const QVector<Sample> & samples );
+}; // class Regression
+
+#endif // REGRESSION_H
@@ -6,6 +6,9 @@ This file contains the settings for the Sphere Cubed application.
 #ifndef SETTINGS
 #define SETTINGS
 
+//! Default number of frames rendered by the benchmark.
+#define BENCHMARK_FRAME_COUNT               1000
+
 //! Camera pitch angle used during game play.
 #define CAMERA_ANGLE_PITCH                  30.0f
 
@@ -21,11 +24,95 @@ This file contains the settings for the Sphere Cubed application.
 //! Camera near clipping plane distance unitless.
 #define CAMERA_NEAR_CLIPPING_PLANE_DISTANCE  0.01f
 
-//! Engine tick interval in mS.
-#define ENGINE_TICK_INTERVAL                50
+//! Number of random cell lookups timed by the chunk benchmark.
+#define CHUNK_BENCHMARK_LOOKUPS             1000000
+
+//! Width and depth in cells of the window of a Level the chunk benchmark looks up.
+#define CHUNK_BENCHMARK_WINDOW              512
+
+//! Key that reports the memory of every subsystem while the Game runs.
+#define ENGINE_MEMORY_REPORT_KEY            Qt::Key_F2
+
+//! Default Engine tick rate in ticks per second.
+#define ENGINE_TICK_RATE                    20
+
+//! Default Engine tick interval in mS.
+#define ENGINE_TICK_INTERVAL                ( 1000 / ENGINE_TICK_RATE )
+
+//! Default generated level hole density from 0 to 1.
+#define GENERATOR_HOLE_DENSITY              0.1f
+
+//! Default generated level maximum Cube height.
+#define GENERATOR_HEIGHT_VARIANCE           4
+
+//! Default generated level width in Cubes.
+#define GENERATOR_COLUMNS                   256
+
+//! Default generated level depth in Cubes.
+#define GENERATOR_ROWS                      256
+
+//! Smallest generated level width or depth the Generator is meant for, smaller ones are warned about.
+#define GENERATOR_MIN_SIZE                  256
+
+//! Largest generated level width or depth the Generator is meant for, larger ones are warned about.
+#define GENERATOR_MAX_SIZE                  4096
+
+//! Number of ticks recorded for each golden physics trajectory.
+#define GOLDEN_TICK_COUNT                   400
+
+//! Default golden physics trajectory tolerance in units in the last place.
+#define GOLDEN_ULP_TOLERANCE                4
+
+//! Number of key transitions the Player Input ring holds between ticks.
+#define INPUT_RING_SIZE                     64
+
+//! Number of Jobs each worker deque holds, a power of two.
+#define JOBS_DEQUE_SIZE                     1024
+
+//! Number of Jobs parallelFor gives each thread when it picks the grain.
+#define JOBS_SPLIT_PER_WORKER               4
+
+//! Number of Jobs worker threads, zero uses one less than the number of cores.
+#define JOBS_WORKER_COUNT                   0
+
+//! Least number of bytes of a block the Level Arena takes from the heap.
+#define LEVEL_ARENA_BLOCK                   ( 256 * 1024 )
+
+//! Most reset Level Arenas kept for reuse, the current Level and the one being prefetched.
+#define LEVEL_ARENA_POOL                    2
+
+//! Most bytes of a reset Level Arena kept for reuse, a larger one is freed.
+#define LEVEL_ARENA_RETAIN                  ( 64 * 1024 * 1024 )
+
+//! Memory budget in bytes of the resident chunks of a chunked Level.
+#define LEVEL_CHUNK_BUDGET                  ( 16 * 1024 * 1024 )
+
+//! Keep the resident chunks of a chunked Level palette encoded instead of decoding them.
+#define LEVEL_CHUNK_PACKED                  false
+
+//! Width and depth in cells of the chunks of the chunk files written.
+#define LEVEL_CHUNK_SIZE                    64
+
+//! Number of Cubes culled per Job when rendering a Level.
+#define LEVEL_CULL_GRAIN                    256
+
+//! Level pack file played when found next to the executable.
+#define LEVEL_PACK_FILE                     "Levels.pack"
+
+//! Maximum number of missed ticks the frame Pacer catches up at once, the rest are dropped.
+#define PACER_CATCH_UP_TICKS                5
+
+//! Maximum number of collision iterations the Physics spends moving the Player in a tick.
+#define PHYSICS_ITERATION_BUDGET            16
+
+//! Distance left after landing on a face below which the Player is at rest, the position precision.
+#define PHYSICS_REST_DISTANCE               0.0001f
+
+//! Number of ticks the Player must be at rest on a Cube before the Physics puts it to sleep.
+#define PHYSICS_SLEEP_TICKS                 10
 
-//! Number of levels in game.
-#define GAME_LEVEL_COUNT                    8
+//! Number of key inputs the Simulation thread input queue holds, a power of two.
+#define SIMULATION_INPUT_QUEUE_SIZE         64
 
 //! Window Height in pixels.
 #define WINDOW_HEIGHT                       480
@@ -0,0 +1,396 @@
+/*! \file simulation.cpp
+\brief Simulation class implementation file.
+This file contains the Simulation thread class implementation for the application.
+*/
+
+// simulation.h header file required for Simulation class definition.
+#include "simulation.h"
+
+// QKeyEvent header file required for queued key input.
+#include <QKeyEvent>
+// QMutexLocker header file required for guarding the play request.
+#include <QMutexLocker>
+
+// chrono header file required for the tick deadlines.
+#include <chrono>
+// thread header file required for sleeping until the tick deadline.
+#include <thread>
+
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The Simulation execution begins here.
+//! Automatically called by the Engine when the threaded mode is selected.
+//! \param timeInterval is the time interval in mS between Simulation ticks.
+//! \param parent is a pointer the QObject parent object.
+Simulation::Simulation( int timeInterval, QObject * parent ) :
+    QThread( parent ),
+    mTimeInterval( timeInterval ),
+    mWorld( timeInterval ),
+    mTopics( 0 ),
+    mStop( false ),
+    mPaused( true ),
+    mPlayRequested( false ),
+    mReloadRequested( false ),
+    mEditRequested( false )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::Simulation()...";
+} // Simulation::Simulation()
+
+//! The Simulation execution ends here.
+//! Automatically called when the Engine is destructed.
+Simulation::~Simulation()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::~Simulation()...";
+
+    //! Make sure the thread is finished before the World goes away.
+    stop();
+} // Simulation::~Simulation()
+
+//! Apply the batches of cell edits ended so far to the simulated Level, as one batch.
+//! An edit refused by the rendered Level was not forwarded, so the Levels stay the same.
+//! \return void
+void Simulation::applyEdits()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::applyEdits()...";
+
+    //! Take the ended batches, a batch still open stays queued.
+    QVector< CellEdit > edits;
+    {
+        QMutexLocker locker( &mMutex );
+        edits = mEdits.mid( 0, mEditsEnded );
+        mEdits.remove( 0, mEditsEnded );
+        mEditsEnded = 0;
+    }
+
+    Level & level = mWorld.level();
+    level.beginEdit();
+
+    for( const CellEdit & edit : edits )
+    {
+        if( edit.height >= 0 )
+        {
+            level.setCubeHeight( edit.column, edit.row, edit.height );
+        } // if( edit.height >= 0 )
+
+        if( edit.type >= 0 )
+        {
+            level.setCubeType( edit.column, edit.row, (Cube::CubeType)edit.type );
+        } // if( edit.type >= 0 )
+    } // for( const CellEdit & edit : edits )
+
+    level.endEdit();
+} // Simulation::applyEdits()
+
+//! Queue a cell edit of the rendered Level, applied to the simulated Level once its batch ends.
+//! \param column is the X position of the cell.
+//! \param row is the Z position of the cell.
+//! \param height is the Cube height set, -1 when unchanged.
+//! \param type is the Cube type set, -1 when unchanged.
+//! \return void
+//! \sa endEdit, Level::setCubeHeight, Level::setCubeType
+void Simulation::edit( uint column, uint row, int height, int type )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::edit( uint column, uint row, int height, int type )...";
+
+    CellEdit edit;
+    edit.column = column;
+    edit.row    = row;
+    edit.height = height;
+    edit.type   = type;
+
+    QMutexLocker locker( &mMutex );
+    mEdits.append( edit );
+} // Simulation::edit( uint column, uint row, int height, int type )
+
+//! End a batch of queued cell edits, the simulated Level applies it before its next tick.
+//! \return void
+//! \sa edit
+void Simulation::endEdit()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::endEdit()...";
+
+    QMutexLocker locker( &mMutex );
+
+    if( mEditsEnded != mEdits.size() )
+    {
+        mEditsEnded = mEdits.size();
+        mEditRequested = true;
+    } // if( mEditsEnded != mEdits.size() )
+} // Simulation::endEdit()
+
+//! Load the requested Level and place the Player at rest at its start position.
+//! Only the Level data is loaded, no OpenGL resources are required.
+//! \return void
+void Simulation::load()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::load()...";
+
+    //! Take the request.
+    {
+        QMutexLocker locker( &mMutex );
+        mWorld.level().levelIndex() = mRequestIndex;
+        mWorld.level().levelFile()  = mRequestFile;
+        mGeneration = mRequestGeneration;
+    }
+
+    //! Input queued for the previous Level no longer applies.
+    KeyInput input;
+    while( mInput.pop( input ) ) {}
+
+    //! Load the Level data.
+    mWorld.level().loadData();
+
+    //! Place the Player at rest at the start position.
+    mWorld.player().reset();
+    mWorld.player().position() = mWorld.level().startPosition();
+    mWorld.player().rotation() = QQuaternion();
+
+    //! Topics left from the previous Level no longer apply.
+    mWorld.bus().take();
+} // Simulation::load()
+
+//! Pause the Simulation until play is called.
+//! \return void
+void Simulation::pause()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::pause()...";
+
+    QMutexLocker locker( &mMutex );
+    mPaused = true;
+} // Simulation::pause()
+
+//! Start simulating a Level from its start position.
+//! Snapshots from before the call are ignored from now on.
+//! \param levelIndex is the Level index to simulate.
+//! \param levelFile is the Level file to simulate instead of the index, when not empty.
+//! \return void
+void Simulation::play( uint levelIndex, const QString & levelFile )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::play()...";
+
+    QMutexLocker locker( &mMutex );
+    mRequestIndex = levelIndex;
+    mRequestFile = levelFile;
+    mRequestGeneration = ++mPlayGeneration;
+    mPlayRequested = true;
+
+    //! Edits queued for the previous Level no longer apply.
+    mEdits.clear();
+    mEditsEnded = 0;
+    mPaused = false;
+    mWake.wakeAll();
+} // Simulation::play( uint levelIndex, const QString & levelFile )
+
+//! Queue an input event for the Simulation.
+//! The key transition is time stamped now, as it arrives, the same as the Player Input does.
+//! \param event is a pointer to a QEvent argument identifing the event.
+//! \return bool is true when the event was a Player key.
+bool Simulation::post( QEvent * event )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::post( QEvent * event )...";
+
+    //! Only key presses and releases are simulated.
+    if( event->type() != QEvent::KeyPress && event->type() != QEvent::KeyRelease )
+    {
+        return false;
+    }
+
+    //! Only the Player keys are simulated.
+    QKeyEvent * keyEvent = (QKeyEvent*)event;
+    KeyInput input;
+    if( Input::key( keyEvent->key(), input.key ) == false )
+    {
+        return false;
+    }
+
+    //! Queue the transition unless it is an auto repeat, a full queue drops it.
+    if( keyEvent->isAutoRepeat() == false )
+    {
+        input.pressed = ( event->type() == QEvent::KeyPress );
+        input.time = Input::now();
+        mInput.push( input );
+    } // if( keyEvent->isAutoRepeat() == false )
+
+    return true;
+} // Simulation::post( QEvent * event )
+
+//! Apply the changes of the Level file to the simulated Level before the next tick.
+//! \return void
+void Simulation::reload()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::reload()...";
+
+    mReloadRequested = true;
+} // Simulation::reload()
+
+//! Run the Simulation ticks at a fixed rate until stopped.
+//! \return void
+void Simulation::run()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::run()...";
+
+    const std::chrono::milliseconds interval( mTimeInterval );
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now();
+
+    while( mStop == false )
+    {
+        //! If a Level was requested, load it and restart the tick deadlines.
+        if( mPlayRequested.exchange( false ) == true )
+        {
+            load();
+            deadline = std::chrono::steady_clock::now();
+        } // if( mPlayRequested.exchange( false ) == true )
+
+        //! If the Level file changed, apply the changes, the Player keeps its state.
+        if( mReloadRequested.exchange( false ) == true )
+        {
+            mWorld.level().reload();
+        } // if( mReloadRequested.exchange( false ) == true )
+
+        //! If batches of cell edits ended, apply them, the Player keeps its state.
+        if( mEditRequested.exchange( false ) == true )
+        {
+            applyEdits();
+        } // if( mEditRequested.exchange( false ) == true )
+
+        //! If paused, sleep until woken by play or stop.
+        if( mPaused == true )
+        {
+            QMutexLocker locker( &mMutex );
+            while( mPaused == true && mStop == false && mPlayRequested == false )
+            {
+                mWake.wait( &mMutex );
+            }
+            continue;
+        } // if( mPaused == true )
+
+        //! Update the Physics.
+        tick();
+
+        //! Sleep until the next tick, if a tick overran do not try to catch up.
+        deadline += interval;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if( deadline < now )
+        {
+            deadline = now;
+        }
+        std::this_thread::sleep_until( deadline );
+    } // while( mStop == false )
+} // Simulation::run()
+
+//! Stop the Simulation thread and wait for it to finish.
+//! \return void
+void Simulation::stop()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::stop()...";
+
+    {
+        QMutexLocker locker( &mMutex );
+        mStop = true;
+        mWake.wakeAll();
+    }
+
+    wait();
+} // Simulation::stop()
+
+//! Apply the newest Snapshot to the GUI thread World.
+//! The Player state is copied and the Bus topics the Physics published are published
+//! again on the World Bus, so the Game State Machine sees the same topics as when the
+//! Physics runs on the GUI thread.
+//! \param world is a reference to the GUI thread World.
+//! \return void
+void Simulation::synchronize( World & world )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::synchronize( World & world )...";
+
+    //! Take the topics before the Snapshot, so the Snapshot is at least as new as the topics.
+    unsigned int topics = mTopics.exchange( 0, std::memory_order_acquire );
+
+    mSnapshots.update();
+    const Snapshot & snapshot = mSnapshots.front();
+
+    //! Ignore Snapshots from before the current play request.
+    if( snapshot.generation != mPlayGeneration )
+    {
+        return;
+    }
+
+    Player & player = world.player();
+
+    //! Follow the Latency measurement through the Simulation.
+    if( snapshot.forced == true )
+    {
+        world.latency().forceApplied();
+    }
+
+    if( player.position() != snapshot.position )
+    {
+        world.latency().positionChanged();
+    }
+
+    //! Copy the Player state.
+    player.position()  = snapshot.position;
+    player.rotation()  = snapshot.rotation;
+    player.direction() = snapshot.direction;
+    player.velocity()  = snapshot.velocity;
+
+    //! Publish the topics with their payload on the World Bus.
+    if( topics & Bus::TOPIC_ENTERED_CELL )
+    {
+        world.bus().publishEnteredCell( snapshot.cellColumn, snapshot.cellRow, snapshot.cellType );
+    }
+
+    if( topics & Bus::TOPIC_LANDED_ON_TYPE )
+    {
+        world.bus().publishLandedOnType( snapshot.landedType );
+    }
+
+    if( topics & Bus::TOPIC_LEFT_LEVEL )
+    {
+        world.bus().publish( Bus::TOPIC_LEFT_LEVEL );
+    }
+} // Simulation::synchronize( World & world )
+
+//! Update the Physics and publish the Snapshot.
+//! \return void
+void Simulation::tick()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "Simulation::tick()...";
+
+    Player & player = mWorld.player();
+
+    //! Record the queued key transitions in the Player Input.
+    KeyInput input;
+    while( mInput.pop( input ) )
+    {
+        player.input().transition( input.key, input.pressed, input.time );
+    }
+
+    //! Update the physics.
+    mWorld.physics().tick( Input::now() );
+
+    //! Fill and publish the Snapshot.
+    Snapshot & snapshot = mSnapshots.back();
+    snapshot.generation = mGeneration;
+    snapshot.position   = player.position();
+    snapshot.rotation   = player.rotation();
+    snapshot.direction  = player.direction();
+    snapshot.velocity   = player.velocity();
+    snapshot.forced     = mWorld.physics().forced();
+    snapshot.cellColumn = mWorld.bus().cellColumn();
+    snapshot.cellRow    = mWorld.bus().cellRow();
+    snapshot.cellType   = mWorld.bus().cellType();
+    snapshot.landedType = mWorld.bus().landedType();
+    mSnapshots.publish();
+
+    //! Hand over the topics after the Snapshot carrying their payload.
+    unsigned int topics = mWorld.bus().take();
+    if( topics != 0 )
+    {
+        mTopics.fetch_or( topics, std::memory_order_release );
+    }
+} // Simulation::tick()
@@ -0,0 +1,204 @@
+/*! \file simulation.h
+\brief Simulation class declaration file.
+This file contains the Simulation thread class declaration for the application.
+*/
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+// QMutex header file required for pausing the thread.
+#include <QMutex>
+// QQuaternion header file required for the Player rotation.
+#include <QQuaternion>
+// QThread header file required for the Simulation thread.
+#include <QThread>
+// QVector header file required for the queued cell edits.
+#include <QVector>
+// QVector3D header file required for the Player position.
+#include <QVector3D>
+// QWaitCondition header file required for waking the paused thread.
+#include <QWaitCondition>
+
+// atomic header file required for the thread flags.
+#include <atomic>
+
+// settings.h header file required for the input queue size.
+#include "settings.h"
+// spscqueue.h header file required for the input queue.
+#include "spscqueue.h"
+// triplebuffer.h header file required for the snapshot handoff.
+#include "triplebuffer.h"
+// world.h header file required for the simulated World.
+#include "world.h"
+
+//! Simulation class.
+/*!
+This class declaration encapsulates the Simulation thread functionality.
+The Simulation runs the game play Physics on its own World in its own thread, so a slow
+frame no longer delays a tick. Key transitions, time stamped as they arrive, are handed
+to it through a lock free queue and the Player state after every tick is handed back as
+an immutable Snapshot through a lock free TripleBuffer. The Game State Machine, and every OpenGL resource, stays on the
+GUI thread and only reads the newest Snapshot. The cell edits of the rendered Level are
+forwarded in whole batches, applied to the simulated Level before the next tick.
+*/
+class Simulation : public QThread
+{
+    //! Friend of Engine so that only Engine can instantiate the Simulation.
+    friend class Engine;
+
+public: // Member Functions
+    //! Called by the GUI thread to queue a cell edit of the rendered Level for the simulated Level.
+    void edit( uint column, uint row, int height, int type );
+
+    //! Called by the GUI thread to end a batch of queued cell edits, applied together.
+    void endEdit();
+
+    //! Called by the GUI thread to stop simulating until play is called.
+    void pause();
+
+    //! Called by the GUI thread to start simulating a Level from its start position.
+    void play( uint levelIndex, const QString & levelFile );
+
+    //! Called by the GUI thread to queue an input event for the Simulation.
+    bool post( QEvent * event );
+
+    //! Called by the GUI thread to apply the changes of the Level file to the simulated Level.
+    void reload();
+
+    //! Called by the GUI thread to apply the newest Snapshot to its World.
+    void synchronize( World & world );
+
+private: // Constructors / Destructors
+    //! Simulation class constructor.
+    explicit Simulation( int timeInterval, QObject * parent = 0 );
+
+    //! Simulation class destructor.
+    ~Simulation();
+
+private: // Data Types
+    //! Internal queued key transition.
+    struct KeyInput
+    {
+        //! - Player key that changed.
+        Input::Key key;
+        //! - True when pressed, false when released.
+        bool pressed;
+        //! - Input time stamp taken when the key event arrived on the GUI thread.
+        qint64 time;
+    }; // struct KeyInput
+
+    //! Internal queued cell edit.
+    struct CellEdit
+    {
+        //! - Column of the edited cell.
+        uint column;
+        //! - Row of the edited cell.
+        uint row;
+        //! - Cube height set, -1 when unchanged.
+        int height;
+        //! - Cube type set, -1 when unchanged.
+        int type;
+    }; // struct CellEdit
+
+    //! Internal Player state published after every tick.
+    struct Snapshot
+    {
+        //! - Play generation the Snapshot belongs to.
+        uint generation = 0;
+        //! - Player position.
+        QVector3D position;
+        //! - Player rotation.
+        QQuaternion rotation;
+        //! - Player heading direction.
+        QVector3D direction;
+        //! - Player velocity.
+        QVector3D velocity;
+        //! - True when a user force was applied on the tick.
+        bool forced = false;
+        //! - Column of the last cell entered.
+        int cellColumn = -1;
+        //! - Row of the last cell entered.
+        int cellRow = -1;
+        //! - Cube type of the last cell entered.
+        unsigned int cellType = 0;
+        //! - Cube type last landed on.
+        unsigned int landedType = 0;
+    }; // struct Snapshot
+
+private: // Member Function
+    //! Called on the Simulation thread to run the ticks.
+    virtual void run();
+
+private: // Helper Functions
+    //! Called on the Simulation thread to apply the ended batches of cell edits.
+    void applyEdits();
+
+    //! Called on the Simulation thread to load the requested Level.
+    void load();
+
+    //! Called to stop the Simulation thread and wait for it to finish.
+    void stop();
+
+    //! Called on the Simulation thread to update the Physics.
+    void tick();
+
+private: // Member Variables
+    //! Used to store the tick time interval in milliseconds.
+    int mTimeInterval;
+
+    //! Used to store the simulated World, only touched by the Simulation thread.
+    World mWorld;
+
+    //! Used to hand key input from the GUI thread to the Simulation thread.
+    SpscQueue< KeyInput, SIMULATION_INPUT_QUEUE_SIZE > mInput;
+
+    //! Used to hand Snapshots from the Simulation thread to the GUI thread.
+    TripleBuffer< Snapshot > mSnapshots;
+
+    //! Used to hand Bus topics published by the Physics to the GUI thread.
+    std::atomic< unsigned int > mTopics;
+
+    //! Used to request the Simulation thread to stop.
+    std::atomic< bool > mStop;
+
+    //! Used to request the Simulation thread to pause.
+    std::atomic< bool > mPaused;
+
+    //! Used to request the Simulation thread to load a Level.
+    std::atomic< bool > mPlayRequested;
+
+    //! Used to request the Simulation thread to reload the Level file.
+    std::atomic< bool > mReloadRequested;
+
+    //! Used to request the Simulation thread to apply the ended batches of cell edits.
+    std::atomic< bool > mEditRequested;
+
+    //! Used to guard the play request and to wait while paused.
+    QMutex mMutex;
+
+    //! Used to wake the Simulation thread while paused.
+    QWaitCondition mWake;
+
+    //! Used to store the requested Level index, guarded by mMutex.
+    uint mRequestIndex = 0;
+
+    //! Used to store the requested Level file, guarded by mMutex.
+    QString mRequestFile;
+
+    //! Used to store the requested play generation, guarded by mMutex.
+    uint mRequestGeneration = 0;
+
+    //! Used to store the queued cell edits, guarded by mMutex.
+    QVector< CellEdit > mEdits;
+
+    //! Used to store the number of queued cell edits in ended batches, guarded by mMutex.
+    int mEditsEnded = 0;
+
+    //! Used to store the play generation being simulated, only touched by the Simulation thread.
+    uint mGeneration = 0;
+
+    //! Used to store the play generation the GUI thread accepts Snapshots for.
+    uint mPlayGeneration = 0;
+}; // class Simulation
+
+#endif // SIMULATION_H
@@ -9,6 +9,8 @@ This file contains the Sphere class implementation for the application.
 // QtMath header file required for Trig functions.
 #include <QtMath>
 
+// memory.h header file required for counting the OpenGL buffer and texture.
+#include "memory.h"
 // trace.h header file required for tracing execution.
 #include "trace.h"
 
@@ -47,6 +49,7 @@ Sphere::~Sphere()
     if( mpTexture != NULL )
     {
         //! Release the Texture.
+        Memory::freed( Memory::TEXTURE_GPU, Memory::textureBytes( *mpTexture ) );
         delete mpTexture;
         //! Set the Texture pointer to NULL.
         mpTexture = NULL;
@@ -193,6 +196,7 @@ bool Sphere::loadBuffer()
 
     //! Allocate space for the vertices with normals and texturecoordinates.
     mBuffer.allocate( mVerticesCount * (3+3+2) * sizeof(GLfloat) );
+    Memory::allocated( Memory::GPU_BUFFERS, mVerticesCount * (3+3+2) * sizeof(GLfloat) );
 
     //! Transfer the vertex data to GPU memory.
     int offset = 0;
@@ -282,14 +286,22 @@ bool Sphere::loadTexture( QString texture )
         return false;
     } // if( image.isNull() == true )
 
+    //! The decoded image is held until it is uploaded.
+    Memory::allocated( Memory::TEXTURE_IMAGES, image.byteCount() );
+
     //! Attempt to allocate memory for the texture and convert the image to an OpenGL texture.
-    if( (mpTexture = new QOpenGLTexture( image )) == NULL )
+    mpTexture = new QOpenGLTexture( image );
+    Memory::freed( Memory::TEXTURE_IMAGES, image.byteCount() );
+
+    if( mpTexture == NULL )
     {
         //! If allocate texture failed Assert to alert there is an issue.
         Q_ASSERT_X( false, "Convert Image to Texture Failed", texture.toLatin1() );
         //! Return false without loading texture.
         return false;
-    } // if( (mpTexture = new QOpenGLTexture( image )) == NULL )
+    } // if( mpTexture == NULL )
+
+    Memory::allocated( Memory::TEXTURE_GPU, Memory::textureBytes( *mpTexture ) );
 
     //! Texture loaded successfully return true.
     return true;
@@ -405,12 +417,19 @@ void Sphere::unload()
     mProgram.release();
 
     //! Release and destroy all buffer.
+    if( mBuffer.isCreated() == true )
+    {
+        Memory::freed( Memory::GPU_BUFFERS, mVerticesCount * (3+3+2) * sizeof(GLfloat) );
+    } // if( mBuffer.isCreated() == true )
+
     mBuffer.release();
     mBuffer.destroy();
 
     //! Release, destroy, and free texture memory.
     if( mpTexture != NULL )
     {
+        Memory::freed( Memory::TEXTURE_GPU, Memory::textureBytes( *mpTexture ) );
+
         mpTexture->release();
         mpTexture->destroy();
 
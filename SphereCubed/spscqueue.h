@@ -0,0 +1,87 @@
+/*! \file spscqueue.h
+\brief SpscQueue class template declaration file.
+This file contains the lock free single producer single consumer SpscQueue class
+template for the application.
+*/
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+// atomic header file required for the lock free head and tail.
+#include <atomic>
+
+//! Bytes of a cache line. The Simulation holding the queue is made with new, so the head
+//! and the tail are kept apart by padding, the alignment would be lost there.
+#define SPSCQUEUE_CACHE_LINE 64
+
+//! SpscQueue class template.
+/*!
+This class template is a fixed size ring of values pushed by one producer thread and
+popped by one consumer thread. The producer only writes the head and the consumer only
+writes the tail, so neither ever waits. Size must be a power of two.
+*/
+template< typename Type, unsigned int Size >
+class SpscQueue
+{
+    static_assert( ( Size & ( Size - 1 ) ) == 0, "SpscQueue Size must be a power of two" );
+
+public: // Constructors / Destructors
+    //! SpscQueue class constructor.
+    SpscQueue() : mHead( 0 ), mTail( 0 ) {}
+
+public: // Member Functions
+    //! Called by the consumer to pop the oldest value.
+    //! \param value is set to the popped value.
+    //! \return bool is false when the queue was empty.
+    bool pop( Type & value )
+    {
+        unsigned int tail = mTail.load( std::memory_order_relaxed );
+
+        if( mHead.load( std::memory_order_acquire ) == tail )
+        {
+            return false;
+        }
+
+        value = mItem[ tail & ( Size - 1 ) ];
+        mTail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    //! Called by the producer to push a value.
+    //! \param value is the value to push.
+    //! \return bool is false when the queue was full and the value was dropped.
+    bool push( const Type & value )
+    {
+        unsigned int head = mHead.load( std::memory_order_relaxed );
+
+        if( head - mTail.load( std::memory_order_acquire ) == Size )
+        {
+            return false;
+        }
+
+        mItem[ head & ( Size - 1 ) ] = value;
+        mHead.store( head + 1, std::memory_order_release );
+        return true;
+    }
+
+private: // Member Variables
+    //! Used to store the ring of values.
+    Type mItem[ Size ];
+
+    //! Used to keep the head off the cache line of the last values.
+    char mItemPadding[ SPSCQUEUE_CACHE_LINE ];
+
+    //! Used to count the values pushed, only written by the producer.
+    std::atomic< unsigned int > mHead;
+
+    //! Used to keep the tail off the cache line of the head.
+    char mHeadPadding[ SPSCQUEUE_CACHE_LINE ];
+
+    //! Used to count the values popped, only written by the consumer, on its own cache line.
+    std::atomic< unsigned int > mTail;
+
+    //! Used to keep the tail off the cache line of whatever follows the queue.
+    char mTailPadding[ SPSCQUEUE_CACHE_LINE ];
+}; // class SpscQueue
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,210 @@
+/*! \file staticmachine.h
+\brief StaticMachine class template declaration file.
+This file contains the compile time StaticMachine class template for the application.
+The States and Transitions of a StaticMachine are declared in type lists, so dispatch
+is a switch table indexed by the current State with no virtual calls and no allocation.
+Transitions are only tested when a Bus topic their Trigger subscribes to is pending.
+*/
+
+#ifndef STATICMACHINE_H
+#define STATICMACHINE_H
+
+// QEvent header file required for forwarding events to a State.
+#include <QEvent>
+
+// bus.h header file required for the Bus topics.
+#include "bus.h"
+// memory.h header file required for counting the StaticMachines.
+#include "memory.h"
+
+// type_traits header file required for compile time type matching.
+#include <type_traits>
+
+
+//------------------------------------------------------------------------------
+// Type Lists
+
+
+//! TypeList class template.
+/*!
+This class template holds a list of types, it is never instantiated.
+*/
+template< typename... Types >
+struct TypeList {};
+
+//! Transition class template.
+/*!
+This class template declares that when the Trigger test passes in the From State the
+StaticMachine transitions to the To State. A Trigger is a class constructed with the
+StaticMachine context that has a bool test() member function and a static TOPICS mask of
+the Bus topics that can change its test result.
+*/
+template< typename From, typename Trigger, typename To >
+struct Transition {};
+
+//! TypeIndex class template.
+/*!
+This class template finds the index of a type in a list of types at compile time.
+*/
+template< typename Type, typename... Types >
+struct TypeIndex;
+
+//! TypeIndex specialization for the type found at the head of the list.
+template< typename Type, typename... Types >
+struct TypeIndex< Type, Type, Types... > : std::integral_constant< unsigned int, 0 > {};
+
+//! TypeIndex specialization for the type not at the head of the list.
+template< typename Type, typename Head, typename... Types >
+struct TypeIndex< Type, Head, Types... > : std::integral_constant< unsigned int, 1 + TypeIndex< Type, Types... >::value > {};
+
+
+//------------------------------------------------------------------------------
+// StaticMachine Class Template Definition
+
+
+//! StaticMachine class template.
+template< typename Context, typename StateList, typename TransitionList >
+class StaticMachine;
+
+//! StaticMachine class template.
+/*!
+This class template encapsulates the compile time State Machine functionality.
+The States are private base classes of the StaticMachine so they live inside it, each
+State and Trigger is constructed with a reference to the Context, which must have a
+Bus & bus() member function. The first State in the list is the start State. Each tick
+the pending Bus topics are taken, and the Transitions out of the current State whose
+Trigger subscribes to one of them are tested in the order declared. The first Trigger to
+pass exits the current State and enters the new one, then the current State is ticked.
+With no topics pending no Trigger is tested at all. Entering a State publishes
+Bus::TOPIC_STATE_ENTERED so the new State's Triggers are tested on the next tick.
+States must declare enter, exit, render and tick member functions, and event when the
+StaticMachine is sent events. They need not be virtual.
+A StaticMachine counts its size, its States included, in the Memory of the state machines.
+*/
+template< typename Context, typename... States, typename... Transitions >
+class StaticMachine< Context, TypeList< States... >, TypeList< Transitions... > > : private States...
+{
+public: // Constructors / Destructors
+    //! StaticMachine class constructor.
+    //! \param context is a reference passed on to every State and Trigger.
+    explicit StaticMachine( Context & context ) :
+        States( context )..., mContext( context ), mIndex( 0 ) { Memory::allocated( Memory::STATE_MACHINES, sizeof( StaticMachine ) ); }
+
+    //! StaticMachine class destructor.
+    ~StaticMachine() { Memory::freed( Memory::STATE_MACHINES, sizeof( StaticMachine ) ); }
+
+public: // Member Functions
+    //! Call to pass an event to the current State.
+    //! \param event is a pointer to a QEvent argument identifing the event.
+    //! \return bool is true when the State processed the event.
+    bool event( QEvent * event )
+    {
+        static bool (* const EVENT[])( StaticMachine &, QEvent * ) = { &StaticMachine::template eventState< States >... };
+        return EVENT[ mIndex ]( *this, event );
+    }
+
+    //! Call to render the current State.
+    //! \return void
+    void render()
+    {
+        static void (* const RENDER[])( StaticMachine & ) = { &StaticMachine::template renderState< States >... };
+        RENDER[ mIndex ]( *this );
+    }
+
+    //! Call once to enter the start State before calling tick.
+    //! \return void
+    void start()
+    {
+        static void (* const ENTER[])( StaticMachine & ) = { &StaticMachine::template enterState< States >... };
+        ENTER[ mIndex ]( *this );
+        mContext.bus().publish( Bus::TOPIC_STATE_ENTERED );
+    }
+
+    //! Access function to get the index of the current State in the State list.
+    //! \return unsigned int is the State index.
+    unsigned int state() const { return mIndex; }
+
+    //! Call periodically to test the Transitions subscribed to the pending topics and update the current State.
+    //! \return void
+    void tick()
+    {
+        static bool (* const TRANSITION[])( StaticMachine &, unsigned int ) = { &StaticMachine::template transitionState< States >... };
+        static void (* const TICK[])( StaticMachine & ) = { &StaticMachine::template tickState< States >... };
+
+        //! Only test Transitions when something was published since the last tick.
+        unsigned int topics = mContext.bus().take();
+
+        if( topics != 0 )
+        {
+            TRANSITION[ mIndex ]( *this, topics );
+        }
+
+        TICK[ mIndex ]( *this );
+    }
+
+private: // Helper Functions
+    //! Called through the switch table to enter a State.
+    template< typename State >
+    static void enterState( StaticMachine & machine ) { static_cast< State & >( machine ).enter(); }
+
+    //! Called through the switch table to pass an event to a State.
+    template< typename State >
+    static bool eventState( StaticMachine & machine, QEvent * event ) { return static_cast< State & >( machine ).event( event ); }
+
+    //! Called through the switch table to render a State.
+    template< typename State >
+    static void renderState( StaticMachine & machine ) { static_cast< State & >( machine ).render(); }
+
+    //! Called through the switch table to tick a State.
+    template< typename State >
+    static void tickState( StaticMachine & machine ) { static_cast< State & >( machine ).tick(); }
+
+    //! Called through the switch table to test the Transitions out of a State.
+    template< typename State >
+    static bool transitionState( StaticMachine & machine, unsigned int topics ) { return machine.template transition< State >( topics, TypeList< Transitions... >() ); }
+
+    //! Called at the end of the Transition list, no Transition was taken.
+    template< typename State >
+    bool transition( unsigned int, TypeList<> ) { return false; }
+
+    //! Called to test the head of the Transition list then the rest of the list.
+    template< typename State, typename From, typename Trigger, typename To, typename... Rest >
+    bool transition( unsigned int topics, TypeList< Transition< From, Trigger, To >, Rest... > )
+    {
+        return transitionFrom< State, Trigger, To >( topics, std::is_same< State, From >() ) ||
+               transition< State >( topics, TypeList< Rest... >() );
+    }
+
+    //! Called for a Transition out of a different State, it is compiled away.
+    template< typename State, typename Trigger, typename To >
+    bool transitionFrom( unsigned int, std::false_type ) { return false; }
+
+    //! Called for a Transition out of the current State, tests the Trigger and transitions.
+    template< typename State, typename Trigger, typename To >
+    bool transitionFrom( unsigned int topics, std::true_type )
+    {
+        //! If the Trigger is not subscribed to a pending topic, or did not pass, do not transition.
+        if( ( topics & Trigger::TOPICS ) == 0 || Trigger( mContext ).test() == false )
+        {
+            return false;
+        }
+
+        //! Exit the current State, change to the new State and enter it.
+        static_cast< State & >( *this ).exit();
+        mIndex = TypeIndex< To, States... >::value;
+        static_cast< To & >( *this ).enter();
+
+        //! Let the new State's Triggers be tested on the next tick.
+        mContext.bus().publish( Bus::TOPIC_STATE_ENTERED );
+        return true;
+    }
+
+private: // Member Variables
+    //! Used to reference the Context passed to the Triggers.
+    Context & mContext;
+
+    //! Used to hold the index of the current State in the State list.
+    unsigned int mIndex;
+}; // class StaticMachine
+
+#endif // STATICMACHINE_H
@@ -0,0 +1,262 @@
+/*! \file supportcheck.cpp
+\brief SupportCheck class implementation file.
+This file contains the SupportCheck class implementation for the application.
+*/
+
+// supportcheck.h header file required for SupportCheck class definition.
+#include "supportcheck.h"
+
+// QElapsedTimer header file required for timing the queries.
+#include <QElapsedTimer>
+
+// random header file required for the seeded positions.
+#include <random>
+
+// levelpack.h header file required for the number of Levels.
+#include "levelpack.h"
+// settings.h header file required for the tick interval and the generated heights.
+#include "settings.h"
+// trace.h header file required for tracing execution.
+#include "trace.h"
+
+//! Trace file execution flag.
+#define TRACE_FILE_EXECUTION false
+
+//! The SupportCheck execution begins here.
+//! Create a SupportCheck with its own World.
+SupportCheck::SupportCheck() :
+    mWorld( ENGINE_TICK_INTERVAL ),
+    mOut( stdout )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "SupportCheck::SupportCheck()...";
+} // SupportCheck::SupportCheck()
+
+//! The SupportCheck execution ends here.
+//! Destroy the SupportCheck.
+SupportCheck::~SupportCheck()
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "SupportCheck::~SupportCheck()...";
+} // SupportCheck::~SupportCheck()
+
+//! Compare the support queries while the cells around the positions are edited, so a stale
+//! support classification is caught. Every few positions a batch of edits raises, lowers or
+//! removes the Cubes of the cell of the position and its neighbours, before it is queried.
+//! \param levelIndex is the Level index, used as the seed so a run can be repeated.
+//! \param samples is the positions.
+//! \return int is the first position the queries disagree on, -1 when they agree.
+int SupportCheck::edited( uint levelIndex, const QVector<QVector3D> & samples )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "SupportCheck::edited()...";
+
+    Level & level = mWorld.level();
+
+    std::mt19937 random( levelIndex );
+    std::uniform_int_distribution<int> offset( -1, 1 );
+    std::uniform_int_distribution<int> plane( 0, GENERATOR_HEIGHT_VARIANCE );
+    std::uniform_int_distribution<int> edits( 0, 3 );
+
+    for( int index = 0; index < samples.size(); index++ )
+    {
+        const QVector3D & position = samples[ index ];
+
+        //! Query first, so the classification of the cell is cached when it is edited.
+        level.playerOnACube( position );
+
+        level.beginEdit();
+        for( int edit = edits( random ); edit > 0; edit-- )
+        {
+            int x = qRound( position.x() ) + offset( random );
+            int z = qRound( position.z() ) + offset( random );
+
+            if( x >= 0 && z >= 0 )
+            {
+                level.setCubeHeight( x, z, plane( random ) );
+                level.setCubeType( x, z, ( offset( random ) < 0 ) ? Cube::HOLE : Cube::STANDARD );
+            } // if( x >= 0 && z >= 0 )
+        } // for( int edit = edits( random ); edit > 0; edit-- )
+        level.endEdit();
+
+        if( level.playerOnACube( position ) != level.playerOnACubeSearch( position ) )
+        {
+            return index;
+        } // if( level.playerOnACube( position ) != level.playerOnACubeSearch( position ) )
+    } // for( int index = 0; index < samples.size(); index++ )
+
+    return -1;
+} // SupportCheck::edited()
+
+//! Fill random positions in and around the loaded Level.
+//! A third are free positions, a third are on the planes on cell edges and corners, and a
+//! third walk in small steps on a plane so the Player stays in a cell for a few queries.
+//! \param levelIndex is the Level index, used as the seed so a run can be repeated.
+//! \param count is the number of positions.
+//! \param samples is filled with the positions.
+//! \return void
+void SupportCheck::positions( uint levelIndex, uint count, QVector<QVector3D> & samples )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "SupportCheck::positions()...";
+
+    Level & level = mWorld.level();
+
+    std::mt19937 random( levelIndex );
+
+    //! Cover the Level and a margin of two cells around it.
+    std::uniform_real_distribution<float> column( -2.0f, level.cubeColumns() + 2.0f );
+    std::uniform_real_distribution<float> row( -2.0f, level.cubeRows() + 2.0f );
+    std::uniform_real_distribution<float> height( -2.0f, GENERATOR_HEIGHT_VARIANCE + 3.0f );
+    std::uniform_int_distribution<int> cell( -2, qMax( level.cubeColumns(), level.cubeRows() ) + 2 );
+    std::uniform_int_distribution<int> plane( -1, GENERATOR_HEIGHT_VARIANCE + 2 );
+    std::uniform_int_distribution<int> offset( -1, 1 );
+    std::uniform_int_distribution<int> kind( 0, 2 );
+    std::uniform_real_distribution<float> step( -0.2f, 0.2f );
+    std::uniform_real_distribution<float> fuzz( -0.000001f, 0.000001f );
+
+    samples.clear();
+    samples.reserve( count );
+
+    QVector3D walk( 0.0f, 0.0f, 0.0f );
+
+    while( (uint)samples.size() < count )
+    {
+        switch( kind( random ) )
+        {
+        //! A free position.
+        case 0:
+            samples.append( QVector3D( column( random ), height( random ), row( random ) ) );
+            break;
+
+        //! A cell centre, edge or corner on a plane, sometimes a fuzz off it.
+        case 1:
+        {
+            float x = cell( random ) + 0.5f * offset( random );
+            float z = cell( random ) + 0.5f * offset( random );
+            float y = plane( random );
+
+            if( offset( random ) == 0 )
+            {
+                x += fuzz( random );
+                y += fuzz( random );
+                z += fuzz( random );
+            } // if( offset( random ) == 0 )
+
+            samples.append( QVector3D( x, y, z ) );
+            break;
+        }
+
+        //! A few small steps of a walk on a plane.
+        default:
+            if( walk.isNull() == true || offset( random ) == 0 )
+            {
+                walk = QVector3D( cell( random ), plane( random ), cell( random ) );
+            } // if( walk.isNull() == true || offset( random ) == 0 )
+
+            for( int index = 0; index < 8 && (uint)samples.size() < count; index++ )
+            {
+                walk += QVector3D( step( random ), 0.0f, step( random ) );
+                samples.append( walk );
+            } // for( int index = 0; index < 8 && ... )
+            break;
+        } // switch( kind( random ) )
+    } // while( (uint)samples.size() < count )
+} // SupportCheck::positions()
+
+//! Compare the cached support query with the search it replaced on every Level, then again
+//! while the cells around the positions are edited.
+//! Reports the first disagreeing position of each Level and the time per query of both.
+//! \param count is the number of random positions per Level.
+//! \return int is the process exit status, zero when every query agreed.
+int SupportCheck::run( uint count )
+{
+    TraceOut( TRACE_FILE_EXECUTION ) << "SupportCheck::run()...";
+
+    Level & level = mWorld.level();
+
+    //! Number of Levels where the queries disagreed.
+    int failures = 0;
+    uint levelCount = LevelPack::instance().count();
+
+    for( uint levelIndex = 1; levelIndex <= levelCount; levelIndex++ )
+    {
+        //! Load the Level data.
+        level.levelIndex() = levelIndex;
+
+        if( level.loadData() == false )
+        {
+            mOut << "Level " << levelIndex << ": unable to load level, " << level.loadError() << endl;
+            failures++;
+            continue;
+        } // if( level.loadData() == false )
+
+        QVector<QVector3D> samples;
+        positions( levelIndex, count, samples );
+
+        //! Answer every position with both queries, timing each.
+        QVector<bool> cached( samples.size() );
+        QVector<bool> searched( samples.size() );
+        QElapsedTimer timer;
+
+        timer.start();
+        for( int index = 0; index < samples.size(); index++ )
+        {
+            cached[ index ] = level.playerOnACube( samples[ index ] );
+        }
+        qint64 cachedTime = timer.nsecsElapsed();
+
+        timer.restart();
+        for( int index = 0; index < samples.size(); index++ )
+        {
+            searched[ index ] = level.playerOnACubeSearch( samples[ index ] );
+        }
+        qint64 searchedTime = timer.nsecsElapsed();
+
+        //! Find the first position they disagree on.
+        int supported = 0;
+        int mismatch = -1;
+
+        for( int index = 0; index < samples.size(); index++ )
+        {
+            supported += searched[ index ] ? 1 : 0;
+
+            if( mismatch < 0 && cached[ index ] != searched[ index ] )
+            {
+                mismatch = index;
+            } // if( mismatch < 0 && cached[ index ] != searched[ index ] )
+        } // for( int index = 0; index < samples.size(); index++ )
+
+        if( mismatch >= 0 )
+        {
+            const QVector3D & position = samples[ mismatch ];
+
+            mOut << "Level " << levelIndex << ": disagree at ("
+                 << QString::number( position.x(), 'g', 9 ) << ", "
+                 << QString::number( position.y(), 'g', 9 ) << ", "
+                 << QString::number( position.z(), 'g', 9 ) << ") cached "
+                 << cached[ mismatch ] << " search " << searched[ mismatch ] << endl;
+            failures++;
+            continue;
+        } // if( mismatch >= 0 )
+
+        //! Query again while the cells around the positions are edited.
+        mismatch = edited( levelIndex, samples );
+
+        if( mismatch >= 0 )
+        {
+            const QVector3D & position = samples[ mismatch ];
+
+            mOut << "Level " << levelIndex << ": disagree after an edit at ("
+                 << QString::number( position.x(), 'g', 9 ) << ", "
+                 << QString::number( position.y(), 'g', 9 ) << ", "
+                 << QString::number( position.z(), 'g', 9 ) << ")" << endl;
+            failures++;
+            continue;
+        } // if( mismatch >= 0 )
+
+        mOut << "Level " << levelIndex << ": ok, " << supported << " of " << samples.size() << " supported, "
+             << QString::number( (double)cachedTime / qMax( 1, samples.size() ), 'f', 1 ) << " nS cached, "
+             << QString::number( (double)searchedTime / qMax( 1, samples.size() ), 'f', 1 ) << " nS search" << endl;
+    } // for( uint levelIndex = 1; levelIndex <= levelCount; levelIndex++ )
+
+    mOut << failures << " of " << levelCount << " levels disagreed" << endl;
+
+    return ( failures == 0 ) ? 0 : 1;
+} // SupportCheck::run()
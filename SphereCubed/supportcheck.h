@@ -0,0 +1,58 @@
+/*! \file supportcheck.h
+\brief SupportCheck class declaration file.
+This file contains the SupportCheck class declaration for the application.
+*/
+
+#ifndef SUPPORTCHECK_H
+#define SUPPORTCHECK_H
+
+// QTextStream header file required for reporting.
+#include <QTextStream>
+// QVector header file required for the sample positions.
+#include <QVector>
+// QVector3D header file required for the sample positions.
+#include <QVector3D>
+
+// world.h header file required for World access.
+#include "world.h"
+
+//! SupportCheck class.
+/*!
+This class declaration encapsulates the support query equivalence SupportCheck functionality.
+Every Level is loaded and Level::playerOnACube(), answered from the cached support
+classification, is compared with Level::playerOnACubeSearch(), the search of the Cubes
+around the Player it replaced, over random positions. The positions favour the planes,
+edges and corners of the cells, where the two can disagree, and walk within cells so the
+cached classification is reused as it is while the Player rolls. The positions are then
+queried again while the cells around them are edited, so an edit that leaves a stale
+classification behind is caught.
+*/
+class SupportCheck
+{
+public: // Constructors / Destructors
+    //! SupportCheck class constructor.
+    SupportCheck();
+
+    //! SupportCheck class destructor.
+    ~SupportCheck();
+
+public: // Member Functions
+    //! Called to compare the support queries over a number of random positions per Level.
+    int run( uint count );
+
+private: // Member Variables
+    //! Used to store the World the Levels are loaded into.
+    World mWorld;
+
+    //! Used to write the report.
+    QTextStream mOut;
+
+private: // Helper Functions
+    //! Called to compare the support queries while the cells around the positions are edited.
+    int edited( uint levelIndex, const QVector<QVector3D> & samples );
+
+    //! Called to fill random positions in and around the loaded Level.
+    void positions( uint levelIndex, uint count, QVector<QVector3D> & samples );
+}; // class SupportCheck
+
+#endif // SUPPORTCHECK_H
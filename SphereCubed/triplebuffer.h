@@ -0,0 +1,78 @@
+/*! \file triplebuffer.h
+\brief TripleBuffer class template declaration file.
+This file contains the lock free TripleBuffer class template for the application.
+One thread writes complete values and another thread reads the newest complete value,
+neither ever waits for the other.
+*/
+
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+// atomic header file required for the lock free slot exchange.
+#include <atomic>
+
+//! TripleBuffer class template.
+/*!
+This class template hands immutable values from one writer thread to one reader thread.
+The writer fills the back slot and publishes it by exchanging it with the middle slot,
+the reader takes the newest value by exchanging its front slot with the middle slot.
+Each thread only ever touches its own slot, so no value is read while it is written.
+*/
+template< typename Type >
+class TripleBuffer
+{
+public: // Constructors / Destructors
+    //! TripleBuffer class constructor.
+    TripleBuffer() : mMiddle( 1 ), mBack( 2 ), mFront( 0 ) {}
+
+public: // Writer Functions
+    //! Called by the writer to get the slot to fill before publishing it.
+    //! \return Type reference to the back slot.
+    Type & back() { return mSlot[ mBack ]; }
+
+    //! Called by the writer to publish the back slot as the newest value.
+    //! \return void
+    void publish() { mBack = mMiddle.exchange( mBack | FRESH, std::memory_order_acq_rel ) & INDEX; }
+
+public: // Reader Functions
+    //! Called by the reader to get the newest value taken by update.
+    //! \return const Type reference to the front slot.
+    const Type & front() const { return mSlot[ mFront ]; }
+
+    //! Called by the reader to take the newest published value, if any.
+    //! \return bool is true when a newer value was taken.
+    bool update()
+    {
+        //! If nothing was published since the last update, keep the front slot.
+        if( ( mMiddle.load( std::memory_order_relaxed ) & FRESH ) == 0 )
+        {
+            return false;
+        }
+
+        //! Swap the front slot for the newest published one.
+        mFront = mMiddle.exchange( mFront, std::memory_order_acq_rel ) & INDEX;
+        return true;
+    }
+
+private: // Data Constants
+    //! Mask of the slot index held in the middle.
+    static const unsigned int INDEX = 0x03;
+
+    //! Flag set in the middle when it holds a value the reader has not taken.
+    static const unsigned int FRESH = 0x04;
+
+private: // Member Variables
+    //! Used to store the three value slots.
+    Type mSlot[3];
+
+    //! Used to exchange the middle slot index and fresh flag between the threads.
+    std::atomic< unsigned int > mMiddle;
+
+    //! Used to store the index of the slot the writer fills, only touched by the writer.
+    unsigned int mBack;
+
+    //! Used to store the index of the slot the reader reads, only touched by the reader.
+    unsigned int mFront;
+}; // class TripleBuffer
+
+#endif // TRIPLEBUFFER_H
@@ -22,13 +22,21 @@ This file contains the Window class implementation for the application.
 //! The Graphical User Interface (GUI) Window execution begins here.
 //! Calling this constructor is required to setup the Window.
 //! Passes parent argument onto base class constructor.
+//! \param options is a reference to the run time options.
 //! \param parent is a pointer the QWidget parent object.
-Window::Window(QWidget *parent)
+Window::Window(const Options &options, QWidget *parent)
     : QGLWidget(QGLFormat(/* Additional format options */), parent),
-      mEngine( ENGINE_TICK_INTERVAL )
+      mOptions( options ),
+      mEngine( options.tickInterval, options )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "Window::Window()...";
 
+    //! When measuring latency, swap the buffers manually so the swap can be time stamped.
+    if( mOptions.latency == true )
+    {
+        setAutoBufferSwap( false );
+    } // if( mOptions.latency == true )
+
     //! Set the window icon.
     setWindowIcon( QIcon( ":/SphereCubedIcon" ) );
 
@@ -109,6 +117,17 @@ void Window::paintGL()
 
     //! Render the Engine.
     mEngine.render();
+
+    //! When measuring latency.
+    if( mOptions.latency == true )
+    {
+        //! Swap the buffers and wait for the swap to complete.
+        swapBuffers();
+        glFinish();
+
+        //! Time stamp the displayed frame.
+        mEngine.swapped();
+    } // if( mOptions.latency == true )
 } // Window::paintGL()
 
 //! Resize OpenGL resources.
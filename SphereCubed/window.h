@@ -14,6 +14,8 @@ This file contains the Window class declaration for the application.
 
 // engine.h header file required for the Engine.
 #include "engine.h"
+// options.h header file required for run time options.
+#include "options.h"
 
 //! Window class.
 /*!
@@ -27,7 +29,7 @@ class Window : public QGLWidget
 
 public: // Constructors / Destructors
     //! Window class constructor.
-    Window( QWidget * parent = 0 );
+    Window( const Options & options = Options(), QWidget * parent = 0 );
 
     //! Window class destructor.
     ~Window();
@@ -50,6 +52,9 @@ protected: // Member Function
     virtual void resizeGL( int width, int height );
 
 private: // Member Variable
+    //! Used to store the run time options.
+    Options mOptions;
+
     //! Used to run and render the game.
     Engine mEngine;
 }; // Window
@@ -0,0 +1,135 @@
+/*! \file workdeque.h
+\brief WorkDeque class template declaration file.
+This file contains the lock free Chase-Lev work stealing WorkDeque class template for
+the application.
+*/
+
+#ifndef WORKDEQUE_H
+#define WORKDEQUE_H
+
+// atomic header file required for the lock free top and bottom.
+#include <atomic>
+
+//! Bytes of a cache line, the top and the bottom are padded apart by one. Padding rather
+//! than alignas, as a plain new in C++11 does not honour an alignment above the default.
+#define WORKDEQUE_CACHE_LINE 64
+
+//! WorkDeque class template.
+/*!
+This class template is a fixed size Chase-Lev work stealing deque of pointers. The owner
+thread pushes and pops at the bottom, like a stack, so it keeps working on the newest and
+cache warm items, while any other thread steals the oldest item from the top. Only the
+last item is contended, and then a single compare and swap decides the winner.
+Size must be a power of two.
+*/
+template< typename Type, unsigned int Size >
+class WorkDeque
+{
+    static_assert( ( Size & ( Size - 1 ) ) == 0, "WorkDeque Size must be a power of two" );
+
+public: // Constructors / Destructors
+    //! WorkDeque class constructor.
+    WorkDeque() : mTop( 0 ), mBottom( 0 )
+    {
+        for( unsigned int index = 0; index < Size; index++ )
+        {
+            mItem[ index ].store( nullptr, std::memory_order_relaxed );
+        }
+    }
+
+public: // Member Functions
+    //! Called by the owner to pop the newest item.
+    //! \return Type * is the popped item, nullptr when the deque was empty or the last item was stolen.
+    Type * pop()
+    {
+        long long bottom = mBottom.load( std::memory_order_relaxed ) - 1;
+        mBottom.store( bottom, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        long long top = mTop.load( std::memory_order_relaxed );
+
+        //! If the deque was empty, restore the bottom.
+        if( top > bottom )
+        {
+            mBottom.store( bottom + 1, std::memory_order_relaxed );
+            return nullptr;
+        }
+
+        Type * item = mItem[ bottom & ( Size - 1 ) ].load( std::memory_order_relaxed );
+
+        //! If it was the last item, race the thieves for it.
+        if( top == bottom )
+        {
+            if( mTop.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) == false )
+            {
+                item = nullptr;
+            }
+
+            mBottom.store( bottom + 1, std::memory_order_relaxed );
+        } // if( top == bottom )
+
+        return item;
+    }
+
+    //! Called by the owner to push an item.
+    //! \param item is the item to push.
+    //! \return bool is false when the deque was full and the item was not pushed.
+    bool push( Type * item )
+    {
+        long long bottom = mBottom.load( std::memory_order_relaxed );
+        long long top = mTop.load( std::memory_order_acquire );
+
+        if( bottom - top >= (long long)Size )
+        {
+            return false;
+        }
+
+        mItem[ bottom & ( Size - 1 ) ].store( item, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        mBottom.store( bottom + 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    //! Called by any other thread to steal the oldest item.
+    //! \return Type * is the stolen item, nullptr when the deque was empty or another thread won it.
+    Type * steal()
+    {
+        long long top = mTop.load( std::memory_order_acquire );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        long long bottom = mBottom.load( std::memory_order_acquire );
+
+        if( top >= bottom )
+        {
+            return nullptr;
+        }
+
+        Type * item = mItem[ top & ( Size - 1 ) ].load( std::memory_order_relaxed );
+
+        if( mTop.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) == false )
+        {
+            return nullptr;
+        }
+
+        return item;
+    }
+
+private: // Member Variables
+    //! Used to store the ring of items.
+    std::atomic< Type * > mItem[ Size ];
+
+    //! Used to keep the top off the cache line of the last items.
+    char mItemPadding[ WORKDEQUE_CACHE_LINE ];
+
+    //! Used to index the oldest item, advanced by the thieves and the owner's last pop.
+    std::atomic< long long > mTop;
+
+    //! Used to keep the bottom off the cache line of the top.
+    char mTopPadding[ WORKDEQUE_CACHE_LINE ];
+
+    //! Used to index past the newest item, only written by the owner, on its own cache line.
+    std::atomic< long long > mBottom;
+
+    //! Used to keep the bottom off the cache line of whatever follows the deque.
+    char mBottomPadding[ WORKDEQUE_CACHE_LINE ];
+}; // class WorkDeque
+
+#endif // WORKDEQUE_H
@@ -17,7 +17,7 @@ This file contains the World class implementation for the application.
 //! Automatically called when the Engine is constructed.
 //! \param timeInterval is the time interval in mS between world updates.
 World::World( int timeInterval ) :
-    mPhysics( timeInterval, mLevel, mPlayer )
+    mPhysics( timeInterval, mBus, mLatency, mLevel, mPlayer )
 {
     TraceOut( TRACE_FILE_EXECUTION ) << "World::World()...";
 } // World::World()
@@ -6,8 +6,12 @@ This file contains the World class declaration for the application.
 #ifndef WORLD_H
 #define WORLD_H
 
+// bus.h header file required for the Game Bus.
+#include "bus.h"
 // camera.h header file required for Camera Machine.
 #include "camera.h"
+// latency.h header file required for Latency.
+#include "latency.h"
 // level.h header file required for Level.
 #include "level.h"
 // light.h header file required for Light.
@@ -19,6 +23,9 @@ This file contains the World class declaration for the application.
 // Player.h header file required for Player.
 #include "player.h"
 
+//! Simulation class forward declaration, the Simulation owns a World.
+class Simulation;
+
 //! World class.
 /*!
 This class declaration encapsulates the World functionality.
@@ -29,7 +36,30 @@ class World
     //! Friend of Engine so that only Engine can instantiate the World.
     friend class Engine;
 
+    //! Friend of Analyzer so that the Level can be analyzed without an Engine.
+    friend class Analyzer;
+
+    //! Friend of Benchmark so that the scene can be rendered without an Engine.
+    friend class Benchmark;
+
+    //! Friend of CycleBenchmark so that the Levels can be cycled without an Engine.
+    friend class CycleBenchmark;
+
+    //! Friend of Regression so that the physics can be replayed without an Engine.
+    friend class Regression;
+
+    //! Friend of Simulation so that the physics can run on its own thread.
+    friend class Simulation;
+
+    //! Friend of SupportCheck so that the support queries can be compared without an Engine.
+    friend class SupportCheck;
+
 public: // Member Functions
+    //! Access function to get reference to the Game Bus.
+    //! \return Bus reference to the topics published for the Game State Machine.
+    //! \sa Bus, Game
+    Bus & bus() { return mBus; }
+
     //! Access function to get reference to Camera functionality.
     //! \return Camera reference to the Camera functionality.
     //! \sa Camera
@@ -45,6 +75,16 @@ public: // Member Functions
     //! \sa Game
     bool getSpace() { return mSpaceKeyPressed; }
 
+    //! Access function to get reference to Latency functionality.
+    //! \return Latency reference to the Latency functionality.
+    //! \sa Latency
+    Latency & latency() { return mLatency; }
+
+    //! Access function to get the time stamp the Player Input is sampled up to on this tick.
+    //! \return qint64 reference to the time stamp in nanoseconds, the deadline of the tick.
+    //! \sa Engine, Physics
+    qint64 & tickTime() { return mTickTime; }
+
     //! Access function to get reference to Level functionality.
     //! \return Menureference to the Level functionality.
     //! \sa Level
@@ -74,13 +114,18 @@ public: // Member Functions
     //! \param value is the state to set trigger to.
     //! \return void
     //! \sa Game
-    void setReturn( bool value ) { mReturnKeyPressed = value; }
+    void setReturn( bool value ) { mReturnKeyPressed = value; if( value ) { mBus.publish( Bus::TOPIC_REQUEST ); } }
 
     //! Access function to set the Space Key condition trigger.
     //! \param value is the state to set trigger to.
     //! \return void
     //! \sa Game
-    void setSpace( bool value ) { mSpaceKeyPressed = value; }
+    void setSpace( bool value ) { mSpaceKeyPressed = value; if( value ) { mBus.publish( Bus::TOPIC_REQUEST ); } }
+
+    //! Access function to get the Simulation thread running the Physics.
+    //! \return Simulation pointer, NULL when the Physics runs on the GUI thread.
+    //! \sa Simulation, Game
+    Simulation * simulation() { return mpSimulation; }
 
 private: // Constructors / Destructors
     //! World class constructor.
@@ -90,9 +135,15 @@ private: // Constructors / Destructors
     ~World();
 
 private: // Member Variables
+    //! Used to store the Game Bus, declared before the Physics that publishes to it.
+    Bus mBus;
+
     //! Used to store the Camera functionality.
     Camera mCamera;
 
+    //! Used to store the Latency functionality.
+    Latency mLatency;
+
     //! Used to store the Level functionality.
     Level mLevel;
 
@@ -108,11 +159,17 @@ private: // Member Variables
     //! Used to store the Player functionality.
     Player mPlayer;
 
+    //! Used to store the time stamp the Player Input is sampled up to on this tick.
+    qint64 mTickTime = 0;
+
     //! Used to trigger the Return Key Event.
     bool mReturnKeyPressed = false;
 
     //! Used to trigger the Space Key Event.
     bool mSpaceKeyPressed  = false;
+
+    //! Used to reference the Simulation thread, initialized to NULL for the single threaded mode.
+    Simulation * mpSimulation = NULL;
 }; // class World
 
 #endif // WORLD_H